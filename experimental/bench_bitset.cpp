@@ -0,0 +1,168 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   bench_bitset.cpp
+/// \brief  `type_bitset` against `std::set<std::type_index>`
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include "mind_bitset.hpp"
+#include "tests/utest_surrogate.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <string>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// Universe of 96 capabilities and random sets over it
+
+template<size_t I> struct cap {};
+
+template<size_t... Is>
+auto caps( std::index_sequence<Is...> ) -> mind::list<cap<Is>...>;
+
+typedef decltype( caps( std::make_index_sequence<96>{} ) ) universe;
+typedef mind::type_bitset<universe> cap_set;
+
+template<size_t... Is>
+std::vector<std::type_index> type_ids( std::index_sequence<Is...> )
+{
+    return { typeid( cap<Is> )... };
+}
+
+template<size_t... Is>
+std::vector<cap_set> singletons( std::index_sequence<Is...> )
+{
+    return { cap_set{}.insert<cap<Is>>()... };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Entry point
+//
+// `bench_bitset [--save=results.json] [--baseline=results.json]`
+
+int main( int argc, char **argv )
+{
+    std::string save, baseline;
+    for ( int i = 1; i < argc; ++i ) {
+        std::string arg = argv[i];
+        if ( arg.rfind( "--save=", 0 ) == 0 ) {
+            save = arg.substr( 7 );
+        }
+        else if ( arg.rfind( "--baseline=", 0 ) == 0 ) {
+            baseline = arg.substr( 11 );
+        }
+    }
+
+    auto ids  = type_ids( std::make_index_sequence<96>{} );
+    auto bits = singletons( std::make_index_sequence<96>{} );
+
+    size_t const count = 4096;
+    std::vector<std::set<std::type_index>> sets( count );
+    std::vector<cap_set> masks( count );
+
+    uint32_t x = 1;
+    for ( size_t i = 0; i < count; ++i ) {
+        size_t n = i % 2 ? 24 : 6; // small requests against large grants
+        for ( size_t k = 0; k < n; ++k ) {
+            size_t t = ( x = x * 1664525u + 1013904223u ) >> 8;
+            t = i % 2 ? t % 96 : t % 24;
+            sets[i].insert( ids[t] );
+            masks[i] |= bits[t];
+        }
+    }
+
+    // every operation goes over the pairs and returns what it found
+    auto set_subset = [&] {
+        size_t hits = 0;
+        for ( size_t i = 0; i < count; i += 2 ) {
+            hits += std::includes( sets[i + 1].begin(), sets[i + 1].end(),
+                                   sets[i].begin(), sets[i].end() );
+        }
+        return hits;
+    };
+
+    auto bit_subset = [&] {
+        size_t hits = 0;
+        for ( size_t i = 0; i < count; i += 2 ) {
+            hits += masks[i].is_subset_of( masks[i + 1] );
+        }
+        return hits;
+    };
+
+    auto set_union = [&] {
+        size_t total = 0;
+        for ( size_t i = 0; i < count; i += 2 ) {
+            std::set<std::type_index> u;
+            std::set_union( sets[i].begin(), sets[i].end(),
+                            sets[i + 1].begin(), sets[i + 1].end(),
+                            std::inserter( u, u.end() ) );
+            total += u.size();
+        }
+        return total;
+    };
+
+    auto bit_union = [&] {
+        size_t total = 0;
+        for ( size_t i = 0; i < count; i += 2 ) {
+            total += ( masks[i] | masks[i + 1] ).count();
+        }
+        return total;
+    };
+
+    std::ostringstream log;
+    unit_test bench( log );
+    if ( !baseline.empty() ) {
+        bench.compare_with( baseline );
+    }
+
+    bench.benchmark( "subset/set", [&] { do_not_optimize( set_subset() ); } )
+         .benchmark( "subset/bitset", [&] { do_not_optimize( bit_subset() ); } )
+         .benchmark( "union/set", [&] { do_not_optimize( set_union() ); } )
+         .benchmark( "union/bitset", [&] { do_not_optimize( bit_union() ); } );
+
+    auto const &results = bench.results();
+    double pairs = double( count / 2 );
+
+    std::cout << std::fixed << std::setprecision( 2 )
+              << "operation  set<type_index>  type_bitset   (ns per op)\n"
+              << "subset     " << std::setw( 15 ) << results[0].median_ns / pairs
+              << std::setw( 13 ) << results[1].median_ns / pairs << "\n"
+              << "union      " << std::setw( 15 ) << results[2].median_ns / pairs
+              << std::setw( 13 ) << results[3].median_ns / pairs << "\n"
+              << "same result "
+              << ( set_subset() == bit_subset() && set_union() == bit_union()
+                       ? "yes" : "no" )
+              << "\n";
+
+    if ( !save.empty() ) {
+        bench.save_json( save );
+    }
+    size_t failed = bench.flush_stat();
+    if ( failed ) {
+        std::cout << "\n" << log.str();
+    }
+    return failed ? 1 : 0;
+}
+
+WUBBA_LUBBA_DUB_DUB
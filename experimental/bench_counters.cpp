@@ -0,0 +1,163 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+/// \file   bench_counters.cpp
+/// \brief  `type_counters` against a shared array of `std::atomic`
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include "mind_counters.hpp"
+#include "tests/utest_surrogate.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// 8 message types, every thread counts each of them in turn
+
+template<size_t I> struct msg {};
+
+template<size_t... Is>
+auto msgs( std::index_sequence<Is...> ) -> mind::list<msg<Is>...>;
+
+typedef std::make_index_sequence<8> kinds;
+typedef mind::type_counters<decltype( msgs( kinds{} ) )> sharded;
+
+struct shared
+{
+    std::atomic<uint64_t> counts[8] = {};
+};
+
+size_t const rounds = 1 << 15;
+
+template<size_t... Is>
+void count_sharded( sharded &c, std::index_sequence<Is...> )
+{
+    for ( size_t r = 0; r < rounds; ++r ) {
+        ( c.add<msg<Is>>(), ... );
+    }
+}
+
+template<size_t... Is>
+void count_shared( shared &c, std::index_sequence<Is...> )
+{
+    for ( size_t r = 0; r < rounds; ++r ) {
+        ( c.counts[Is].fetch_add( 1, std::memory_order_relaxed ), ... );
+    }
+}
+
+// a call runs `threads` threads started together on fresh counters
+template<class Counters, class F>
+auto contend( size_t threads, F f )
+{
+    return [threads, f] {
+        Counters c;
+        std::atomic<bool> go{ false };
+        std::vector<std::thread> pool;
+
+        for ( size_t t = 0; t < threads; ++t ) {
+            pool.emplace_back( [&] {
+                while ( !go.load( std::memory_order_acquire ) ) {
+                    std::this_thread::yield();
+                }
+                f( c );
+            } );
+        }
+        go.store( true, std::memory_order_release );
+        for ( auto &t : pool ) {
+            t.join();
+        }
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Entry point
+//
+// `bench_counters [--save=results.json] [--baseline=results.json]`
+
+int main( int argc, char **argv )
+{
+    std::string save, baseline;
+    for ( int i = 1; i < argc; ++i ) {
+        std::string arg = argv[i];
+        if ( arg.rfind( "--save=", 0 ) == 0 ) {
+            save = arg.substr( 7 );
+        }
+        else if ( arg.rfind( "--baseline=", 0 ) == 0 ) {
+            baseline = arg.substr( 11 );
+        }
+    }
+
+    // a call is long enough on its own, the thread start is in the timing
+    bench_options options;
+    options.warmup     = 1;
+    options.runs       = 5;
+    options.min_run_ns = 0;
+
+    std::ostringstream log;
+    unit_test bench( log );
+    if ( !baseline.empty() ) {
+        bench.compare_with( baseline );
+    }
+
+    std::vector<size_t> counts;
+    for ( size_t threads = 1; threads <= 64; threads *= 2 ) {
+        counts.push_back( threads );
+        bench.benchmark( "shared/" + std::to_string( threads ),
+                         contend<shared>( threads, []( shared &c ) {
+                             count_shared( c, kinds{} );
+                         } ),
+                         options );
+        bench.benchmark( "sharded/" + std::to_string( threads ),
+                         contend<sharded>( threads, []( sharded &c ) {
+                             count_sharded( c, kinds{} );
+                         } ),
+                         options );
+    }
+
+    std::cout << "hardware threads " << std::thread::hardware_concurrency()
+              << "\n\n"
+              << "threads  shared atomic  type_counters   (ns per increment)\n"
+              << std::fixed << std::setprecision( 2 );
+
+    auto const &results = bench.results();
+    for ( size_t i = 0; i < counts.size(); ++i ) {
+        double increments = double( counts[i] * rounds * 8 );
+        std::cout << std::setw( 7 ) << counts[i]
+                  << std::setw( 15 ) << results[2 * i].median_ns / increments
+                  << std::setw( 15 ) << results[2 * i + 1].median_ns / increments
+                  << "\n";
+    }
+
+    if ( !save.empty() ) {
+        bench.save_json( save );
+    }
+    size_t failed = bench.flush_stat();
+    if ( failed ) {
+        std::cout << "\n" << log.str();
+    }
+    return failed ? 1 : 0;
+}
+
+WUBBA_LUBBA_DUB_DUB
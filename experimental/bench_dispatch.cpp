@@ -0,0 +1,92 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   bench_dispatch.cpp
+/// \brief  Throughput of `reduce_kernel` for every backend
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include "mind_reduce.hpp"
+#include "tests/utest_surrogate.hpp"
+
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// Entry point
+//
+// `bench_dispatch [--save=results.json] [--baseline=results.json]`
+
+int main( int argc, char **argv )
+{
+    using namespace mind;
+
+    std::vector<int32_t> values( 1 << 20 );
+    for ( size_t i = 0; i < values.size(); ++i ) {
+        values[i] = int32_t( i * 2654435761u );
+    }
+
+    int32_t const *p = values.data();
+    size_t n = values.size();
+
+    std::string save, baseline;
+    for ( int i = 1; i < argc; ++i ) {
+        std::string arg = argv[i];
+        if ( arg.rfind( "--save=", 0 ) == 0 ) {
+            save = arg.substr( 7 );
+        }
+        else if ( arg.rfind( "--baseline=", 0 ) == 0 ) {
+            baseline = arg.substr( 11 );
+        }
+    }
+
+    bench_options options;
+    options.counters = true;
+
+    unit_test bench( std::cout );
+    if ( !baseline.empty() ) {
+        bench.compare_with( baseline );
+    }
+
+    std::cout << "reduce of " << n << " integers, dispatch chose "
+              << reduce::active() << "\n\n";
+
+    bench.benchmark( "reduce/scalar", [&] {
+        do_not_optimize( reduce_kernel<isa::scalar>::run( p, n ) );
+    }, options );
+#if MIND_X86
+    if ( isa::sse42::supported() ) {
+        bench.benchmark( "reduce/sse4.2", [&] {
+            do_not_optimize( reduce_kernel<isa::sse42>::run( p, n ) );
+        }, options );
+    }
+    if ( isa::avx2::supported() ) {
+        bench.benchmark( "reduce/avx2", [&] {
+            do_not_optimize( reduce_kernel<isa::avx2>::run( p, n ) );
+        }, options );
+    }
+#endif
+    bench.benchmark( "reduce/dispatch", [&] {
+        do_not_optimize( reduce::run( p, n ) );
+    }, options );
+
+    if ( !save.empty() ) {
+        bench.save_json( save );
+    }
+    return bench.flush_stat() ? 1 : 0;
+}
+
+WUBBA_LUBBA_DUB_DUB
@@ -0,0 +1,74 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   bench_logger.cpp
+/// \brief  Cost of a log statement at the call site
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include "mind_logger.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+////////////////////////////////////////////////////////////////////////////////
+// Entry point
+
+int main()
+{
+    using clock = std::chrono::steady_clock;
+
+    int const lines = 10000; // fits the ring, nothing is dropped
+    std::ostringstream sink;
+    double logged_ns = 0, formatted_ns = 0;
+    uint64_t dropped = 0;
+
+    {
+        mind::logger log( sink, mind::logger::binary, 1 << 22 );
+        MIND_LOG( log, "warm up {i}", 0 );
+
+        auto start = clock::now();
+        for ( int i = 0; i < lines; ++i ) {
+            MIND_LOG( log, "request {id} user {user} took {ms} ms",
+                      i, uint64_t( i * 7 ), i * 0.25 );
+        }
+        std::chrono::duration<double, std::nano> ns = clock::now() - start;
+        logged_ns = ns.count() / lines;
+        dropped   = log.dropped();
+    }
+
+    {
+        auto start = clock::now();
+        for ( int i = 0; i < lines; ++i ) {
+            std::ostringstream line;
+            line << "request " << i << " user " << uint64_t( i * 7 )
+                 << " took " << i * 0.25 << " ms\n";
+            sink << line.str();
+        }
+        std::chrono::duration<double, std::nano> ns = clock::now() - start;
+        formatted_ns = ns.count() / lines;
+    }
+
+    std::cout << std::fixed << std::setprecision( 1 )
+              << "MIND_LOG            " << logged_ns << " ns per line"
+              << " (" << dropped << " dropped)\n"
+              << "format at the call  " << formatted_ns << " ns per line\n";
+
+    return 0;
+}
+
+WUBBA_LUBBA_DUB_DUB
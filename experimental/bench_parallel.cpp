@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   bench_parallel.cpp
+/// \brief  Scaling of `parallel_for_each` over a tuple of columns
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include "mind_parallel.hpp"
+#include "tests/utest_surrogate.hpp"
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// Columns of different length, compressed by delta + varint
+
+template<size_t I> struct column
+{
+    enum : size_t { rows = ( 1 + I % 4 ) << 16 };
+
+    column() : data( rows ), packed( rows * 5 )
+    {
+        uint32_t x = I;
+        for ( auto &v : data ) {
+            v = ( x = x * 1664525u + 1013904223u ) >> 12;
+        }
+    }
+
+    std::vector<uint32_t> data;
+    std::vector<uint8_t> packed;
+    size_t bytes = 0;
+};
+
+template<class T> struct row_cost { enum : size_t { value = T::rows }; };
+
+struct compress
+{
+    template<class Column>
+    void operator()( Column &c ) const
+    {
+        for ( int pass = 0; pass < 8; ++pass ) {
+            uint8_t *out  = c.packed.data();
+            uint32_t prev = 0;
+
+            for ( uint32_t v : c.data ) {
+                uint32_t zz = ( ( v - prev ) << 1 ) ^ -( ( v - prev ) >> 31 );
+                prev = v;
+                while ( zz >= 0x80 ) {
+                    *out++ = uint8_t( zz | 0x80 );
+                    zz   >>= 7;
+                }
+                *out++ = uint8_t( zz );
+            }
+            c.bytes = out - c.packed.data();
+        }
+    }
+};
+
+template<size_t... Is>
+auto make_columns( std::index_sequence<Is...> )
+{
+    return std::tuple<column<Is>...>{};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Entry point
+//
+// `bench_parallel [--save=results.json] [--baseline=results.json]`
+
+int main( int argc, char **argv )
+{
+    using namespace mind;
+
+    std::string save, baseline;
+    for ( int i = 1; i < argc; ++i ) {
+        std::string arg = argv[i];
+        if ( arg.rfind( "--save=", 0 ) == 0 ) {
+            save = arg.substr( 7 );
+        }
+        else if ( arg.rfind( "--baseline=", 0 ) == 0 ) {
+            baseline = arg.substr( 11 );
+        }
+    }
+
+    auto columns = make_columns( std::make_index_sequence<32>{} );
+
+    // a call compresses all the columns, long enough on its own
+    bench_options options;
+    options.warmup     = 1;
+    options.runs       = 5;
+    options.min_run_ns = 0;
+
+    std::ostringstream log;
+    unit_test bench( log );
+    if ( !baseline.empty() ) {
+        bench.compare_with( baseline );
+    }
+
+    std::vector<size_t> counts;
+    for ( size_t threads = 1; threads <= 32; threads *= 2 ) {
+        thread_pool pool( threads - 1 ); // the caller is a worker too
+
+        counts.push_back( threads );
+        bench.benchmark( "compress/" + std::to_string( threads ), [&] {
+            parallel_for_each<32, row_cost>( columns, compress{}, pool );
+            do_not_optimize( std::get<0>( columns ).bytes );
+        }, options );
+    }
+
+    std::cout << "threads     ms  speedup\n";
+
+    auto const &results = bench.results();
+    for ( size_t i = 0; i < counts.size(); ++i ) {
+        double ms = results[i].median_ns / 1e6;
+        std::cout << std::setw( 7 ) << counts[i]
+                  << std::setw( 7 ) << std::fixed << std::setprecision( 1 ) << ms
+                  << std::setw( 9 ) << std::setprecision( 2 )
+                  << results[0].median_ns / results[i].median_ns
+                  << "\n";
+    }
+
+    if ( !save.empty() ) {
+        bench.save_json( save );
+    }
+    size_t failed = bench.flush_stat();
+    if ( failed ) {
+        std::cout << "\n" << log.str();
+    }
+    return failed ? 1 : 0;
+}
+
+WUBBA_LUBBA_DUB_DUB
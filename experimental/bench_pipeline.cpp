@@ -0,0 +1,226 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   bench_pipeline.cpp
+/// \brief  6-stage fused `pipeline` against a chain of virtual stages
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include "mind_pipeline.hpp"
+#include "tests/utest_surrogate.hpp"
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// Record and the operations on it
+
+struct record
+{
+    int64_t id;
+    double value;
+};
+
+inline record scale( record r ) { return { r.id, r.value * 1.5 + 3 }; }
+inline bool   keep_even( record const &r ) { return ( r.id & 1 ) == 0; }
+inline record square( record r ) { return { r.id, r.value * r.value }; }
+inline bool   below( record const &r ) { return r.value < 1e12; }
+inline record shift( record r, int64_t &seq ) { return { r.id + seq++, r.value }; }
+inline record project( record r ) { return { r.id, r.value - double( r.id ) }; }
+
+////////////////////////////////////////////////////////////////////////////////
+// Fused stages
+
+struct scale_stage : mind::map_stage
+{
+    record operator()( record r ) const { return scale( r ); }
+};
+
+struct even_stage : mind::filter_stage
+{
+    bool operator()( record const &r ) const { return keep_even( r ); }
+};
+
+struct square_stage : mind::map_stage
+{
+    record operator()( record r ) const { return square( r ); }
+};
+
+struct below_stage : mind::filter_stage
+{
+    bool operator()( record const &r ) const { return below( r ); }
+};
+
+struct shift_stage : mind::stateful_stage
+{
+    record operator()( record r ) { return shift( r, seq ); }
+    int64_t seq = 0;
+};
+
+struct project_stage : mind::map_stage
+{
+    record operator()( record r ) const { return project( r ); }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Virtual stages, each writes a buffer of its own
+
+struct stage
+{
+    virtual ~stage() {}
+    virtual void process( std::vector<record> const &in,
+                          std::vector<record> &out ) = 0;
+};
+
+template<class F> struct map_of : stage
+{
+    map_of( F f ) : f_{ f } {}
+    void process( std::vector<record> const &in, std::vector<record> &out ) override
+    {
+        out.clear();
+        for ( auto const &r : in ) {
+            out.push_back( f_( r ) );
+        }
+    }
+    F f_;
+};
+
+template<class F> struct filter_of : stage
+{
+    filter_of( F f ) : f_{ f } {}
+    void process( std::vector<record> const &in, std::vector<record> &out ) override
+    {
+        out.clear();
+        for ( auto const &r : in ) {
+            if ( f_( r ) ) {
+                out.push_back( r );
+            }
+        }
+    }
+    F f_;
+};
+
+template<template<class> class Kind, class F>
+std::unique_ptr<stage> make( F f )
+{
+    return std::make_unique<Kind<F>>( f );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Entry point
+//
+// `bench_pipeline [--save=results.json] [--baseline=results.json]`
+
+int main( int argc, char **argv )
+{
+    std::string save, baseline;
+    for ( int i = 1; i < argc; ++i ) {
+        std::string arg = argv[i];
+        if ( arg.rfind( "--save=", 0 ) == 0 ) {
+            save = arg.substr( 7 );
+        }
+        else if ( arg.rfind( "--baseline=", 0 ) == 0 ) {
+            baseline = arg.substr( 11 );
+        }
+    }
+
+    std::vector<record> input( 1 << 22 );
+    for ( size_t i = 0; i < input.size(); ++i ) {
+        input[i] = { int64_t( i ), double( i % 1000 ) };
+    }
+
+    auto fused = [&] {
+        double sum = 0;
+        mind::pipeline<mind::list<scale_stage, even_stage, square_stage,
+                                  below_stage, shift_stage, project_stage>> p;
+        p.run( input, [&]( record const &r ) { sum += r.value; } );
+        return sum;
+    };
+
+    // buffers between the virtual stages are allocated once, out of timing
+    std::vector<record> a, b;
+    a.reserve( input.size() );
+    b.reserve( input.size() );
+
+    auto chained = [&] {
+        double sum  = 0;
+        int64_t seq = 0;
+        std::vector<std::unique_ptr<stage>> chain;
+        chain.push_back( make<map_of>( scale ) );
+        chain.push_back( make<filter_of>( keep_even ) );
+        chain.push_back( make<map_of>( square ) );
+        chain.push_back( make<filter_of>( below ) );
+        chain.push_back( make<map_of>( [&seq]( record r ) { return shift( r, seq ); } ) );
+        chain.push_back( make<map_of>( project ) );
+
+        // the first stage reads the input in place, as the fused one does
+        chain.front()->process( input, a );
+        for ( size_t s = 1; s < chain.size(); ++s ) {
+            chain[s]->process( a, b );
+            a.swap( b );
+        }
+        for ( auto const &r : a ) {
+            sum += r.value;
+        }
+        return sum;
+    };
+
+    // a call goes over all the items, long enough on its own
+    bench_options options;
+    options.warmup     = 1;
+    options.runs       = 5;
+    options.min_run_ns = 0;
+
+    std::ostringstream log;
+    unit_test bench( log );
+    if ( !baseline.empty() ) {
+        bench.compare_with( baseline );
+    }
+
+    bench.benchmark( "pipeline/fused", [&] {
+        do_not_optimize( fused() );
+    }, options );
+    bench.benchmark( "pipeline/virtual", [&] {
+        do_not_optimize( chained() );
+    }, options );
+
+    double fused_ms   = bench.results()[0].median_ns / 1e6;
+    double virtual_ms = bench.results()[1].median_ns / 1e6;
+
+    std::cout << std::fixed << std::setprecision( 2 )
+              << "items            " << input.size() << "\n"
+              << "fused pipeline   " << fused_ms << " ms\n"
+              << "virtual stages   " << virtual_ms << " ms\n"
+              << "speedup          " << virtual_ms / fused_ms << "\n"
+              << "same result      " << ( fused() == chained() ? "yes" : "no" )
+              << "\n";
+
+    if ( !save.empty() ) {
+        bench.save_json( save );
+    }
+    size_t failed = bench.flush_stat();
+    if ( failed ) {
+        std::cout << "\n" << log.str();
+    }
+    return failed ? 1 : 0;
+}
+
+WUBBA_LUBBA_DUB_DUB
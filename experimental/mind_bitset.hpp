@@ -0,0 +1,204 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   mind_bitset.hpp
+/// \brief  runtime sets of types as bit masks over a universe list
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "mind_core.hpp"
+
+namespace mind
+{
+////////////////////////////////////////////////////////////////////////////////
+//
+//  TYPE_BITSET
+
+template<class Universe> class type_bitset;
+
+/*!
+\class   `type_bitset<Head<Us...>>`
+\brief   set of types of the universe `<Us...>`, one bit per type.
+
+\details The bit of a type is its `index_of_v` in the universe, so a set is
+         a fixed array of words and the algebra is a few `and`/`or`.
+         `of<TList>()` is the `constexpr` mask of a compile-time list;
+         `complement` and `is_subset_of` agree with `complement_t` and
+         `is_subset_v` on such masks.
+         Usage: `constexpr auto io = type_bitset<caps>::of<list<read, write>>();`
+                `if ( io.is_subset_of( granted ) ) ...`
+*/
+template<$class Head, class... Us>
+class type_bitset<Head<Us...>>
+{
+public:
+
+    $def Head<Us...> universe;
+
+    static constexpr size_t size  = sizeof...( Us );
+    static constexpr size_t words = ( size + 63 ) / 64;
+
+    /// \brief   bit of `T`, fails to compile outside of the universe.
+    template<class T>
+    static constexpr size_t bit()
+    {
+        static_assert( is_member_v<T, universe>,
+                       "mind::type_bitset: type is not in the universe" );
+        return index_of_v<T, universe>;
+    }
+
+    constexpr type_bitset() = default;
+
+    /// \brief   mask of the types of `TList`.
+    template<class TList>
+    static constexpr type_bitset of()
+    {
+        return of_list( mind::apply<list, TList>{} );
+    }
+
+    template<class T>
+    constexpr type_bitset& insert()
+    {
+        bits_[bit<T>() / 64] |= uint64_t( 1 ) << bit<T>() % 64;
+        return *this;
+    }
+
+    template<class T>
+    constexpr type_bitset& erase()
+    {
+        bits_[bit<T>() / 64] &= ~( uint64_t( 1 ) << bit<T>() % 64 );
+        return *this;
+    }
+
+    template<class T>
+    constexpr bool contains() const
+    {
+        return bits_[bit<T>() / 64] >> bit<T>() % 64 & 1;
+    }
+
+    constexpr bool empty() const
+    {
+        uint64_t any = 0;
+        for ( size_t i = 0; i < words; ++i ) {
+            any |= bits_[i];
+        }
+        return any == 0;
+    }
+
+    constexpr size_t count() const
+    {
+        size_t n = 0;
+        for ( size_t i = 0; i < words; ++i ) {
+            for ( uint64_t w = bits_[i]; w; w &= w - 1 ) {
+                ++n;
+            }
+        }
+        return n;
+    }
+
+    /// \brief   `true` if every type of `*this` is in `major`,
+    ///          as `is_subset_v<This, Major>`.
+    constexpr bool is_subset_of( type_bitset const &major ) const
+    {
+        uint64_t extra = 0;
+        for ( size_t i = 0; i < words; ++i ) {
+            extra |= bits_[i] & ~major.bits_[i];
+        }
+        return extra == 0;
+    }
+
+    /// \brief   types of `*this` which are not in `other`,
+    ///          as `complement_t<This, Other>`.
+    constexpr type_bitset complement( type_bitset const &other ) const
+    {
+        return type_bitset( *this ) -= other;
+    }
+
+    constexpr type_bitset& operator|=( type_bitset const &other )
+    {
+        for ( size_t i = 0; i < words; ++i ) {
+            bits_[i] |= other.bits_[i];
+        }
+        return *this;
+    }
+
+    constexpr type_bitset& operator&=( type_bitset const &other )
+    {
+        for ( size_t i = 0; i < words; ++i ) {
+            bits_[i] &= other.bits_[i];
+        }
+        return *this;
+    }
+
+    constexpr type_bitset& operator-=( type_bitset const &other )
+    {
+        for ( size_t i = 0; i < words; ++i ) {
+            bits_[i] &= ~other.bits_[i];
+        }
+        return *this;
+    }
+
+    friend constexpr type_bitset operator|( type_bitset a, type_bitset const &b )
+    {
+        return a |= b;
+    }
+
+    friend constexpr type_bitset operator&( type_bitset a, type_bitset const &b )
+    {
+        return a &= b;
+    }
+
+    friend constexpr type_bitset operator-( type_bitset a, type_bitset const &b )
+    {
+        return a -= b;
+    }
+
+    friend constexpr bool operator==( type_bitset const &a, type_bitset const &b )
+    {
+        for ( size_t i = 0; i < words; ++i ) {
+            if ( a.bits_[i] != b.bits_[i] ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    friend constexpr bool operator!=( type_bitset const &a, type_bitset const &b )
+    {
+        return !( a == b );
+    }
+
+    constexpr uint64_t word( size_t i ) const { return bits_[i]; }
+
+private:
+
+    template<class... Ts>
+    static constexpr type_bitset of_list( list<Ts...> )
+    {
+        type_bitset s;
+        ( s.template insert<Ts>(), ... );
+        return s;
+    }
+
+    std::array<uint64_t, words> bits_{};
+};
+} // mind
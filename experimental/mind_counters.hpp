@@ -0,0 +1,145 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   mind_counters.hpp
+/// \brief  event counters per type, sharded per thread
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string_view>
+
+#include "mind_core.hpp"
+#include "mind_slots.hpp"
+#include "mind_util.hpp"
+
+namespace mind
+{
+////////////////////////////////////////////////////////////////////////////////
+//
+//  TYPE_COUNTERS
+
+template<class TList> class type_counters;
+
+/*!
+\class   `type_counters<Head<Ts...>>`
+\brief   a counter per type of `<Ts...>`, every thread counts in its own shard.
+
+\details The counter of a type is at its `index_of_v` in the list. A shard
+         is a line-aligned array of counters written by one thread only, so
+         `add` is a relaxed load and store without a locked instruction and
+         without sharing a cache line with other threads. `snapshot` sums
+         the shards. A shard goes back to the set when its thread exits
+         and the next new thread counts on in it, no count is lost and
+         thread churn does not grow the set.
+         Usage: `type_counters<list<order, cancel>> seen;`
+                `seen.add<order>();`
+                `seen.expose( std::cout, "messages_total" );`
+*/
+template<$class Head, class... Ts>
+class type_counters<Head<Ts...>>
+{
+public:
+
+    $def Head<Ts...> types;
+
+    static constexpr size_t size = sizeof...( Ts );
+
+    struct alignas( 64 ) shard
+    {
+        std::atomic<uint64_t> counts[size ? size : 1] = {};
+    };
+
+    type_counters() = default;
+
+    type_counters( type_counters const & )            = delete;
+    type_counters& operator=( type_counters const & ) = delete;
+
+    /// \brief   count `n` events of `T`, fails to compile outside of `types`.
+    template<class T>
+    void add( uint64_t n = 1 )
+    {
+        static_assert( is_member_v<T, types>,
+                       "mind::type_counters: type is not counted" );
+
+        std::atomic<uint64_t> &c = local_shard().counts[index_of_v<T, types>];
+        c.store( c.load( std::memory_order_relaxed ) + n,
+                 std::memory_order_relaxed );
+    }
+
+    /// \brief   totals of all the shards, in order of `types`.
+    std::array<uint64_t, size> snapshot() const
+    {
+        std::array<uint64_t, size> totals{};
+
+        for ( shard const *s : shards_.all() ) {
+            for ( size_t i = 0; i < size; ++i ) {
+                totals[i] += s->counts[i].load( std::memory_order_relaxed );
+            }
+        }
+        return totals;
+    }
+
+    /// \brief   number of shards, at most the threads ever counting at once.
+    size_t shards() const { return shards_.size(); }
+
+    /// \brief   total of `T`, fails to compile outside of `types`.
+    template<class T>
+    uint64_t count() const
+    {
+        static_assert( is_member_v<T, types>,
+                       "mind::type_counters: type is not counted" );
+
+        return snapshot()[index_of_v<T, types>];
+    }
+
+    /// \brief   write a snapshot in the text exposition format, a sample
+    ///          per type labelled by its `type_name`.
+    void expose( std::ostream &out, std::string_view metric ) const
+    {
+        auto totals = snapshot();
+        std::string_view names[] = { type_name<Ts>()..., "" };
+
+        out << "# TYPE " << metric << " counter\n";
+        for ( size_t i = 0; i < size; ++i ) {
+            out << metric << "{type=\"";
+            for ( char c : names[i] ) {
+                if ( c == '\\' || c == '"' ) {
+                    out << '\\';
+                }
+                out << c;
+            }
+            out << "\"} " << totals[i] << "\n";
+        }
+    }
+
+private:
+
+    shard& local_shard()
+    {
+        return shards_.local( [] { return std::make_unique<shard>(); } );
+    }
+
+    thread_slots<shard> shards_;
+};
+} // mind
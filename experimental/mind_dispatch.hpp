@@ -0,0 +1,268 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   mind_dispatch.hpp
+/// \brief  runtime choice of kernels among instruction set backends
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include <atomic>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "mind_core.hpp"
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#define MIND_X86 1
+#include <cpuid.h>
+#elif defined( _M_X64 ) || defined( _M_IX86 )
+#define MIND_X86 1
+#include <intrin.h>
+#else
+#define MIND_X86 0
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Code generation for an instruction set without a global `-m` flag
+
+#if MIND_X86 && ( defined( __GNUC__ ) || defined( __clang__ ) )
+#define MIND_TARGET( isa ) __attribute__( ( target( isa ) ) )
+#else
+#define MIND_TARGET( isa )
+#endif
+
+namespace mind
+{
+////////////////////////////////////////////////////////////////////////////////
+//
+//  CPU FEATURES
+
+struct cpu_features
+{
+    bool sse42   = false;
+    bool avx2    = false;
+    bool avx512f = false;
+};
+
+namespace impl
+{
+inline void cpuid( unsigned leaf, unsigned sub, unsigned ( &r )[4] )
+{
+#if MIND_X86 && defined( _MSC_VER )
+    int regs[4];
+    __cpuidex( regs, int( leaf ), int( sub ) );
+    for ( int i = 0; i < 4; ++i ) {
+        r[i] = unsigned( regs[i] );
+    }
+#elif MIND_X86
+    if ( !__get_cpuid_count( leaf, sub, &r[0], &r[1], &r[2], &r[3] ) ) {
+        r[0] = r[1] = r[2] = r[3] = 0;
+    }
+#else
+    (void)leaf, (void)sub;
+    r[0] = r[1] = r[2] = r[3] = 0;
+#endif
+}
+
+// register state enabled by the OS, `XCR0`
+inline unsigned long long xgetbv()
+{
+#if MIND_X86 && defined( _MSC_VER )
+    return _xgetbv( 0 );
+#elif MIND_X86
+    unsigned lo, hi;
+    __asm__ volatile ( "xgetbv" : "=a" ( lo ), "=d" ( hi ) : "c" ( 0 ) );
+    return ( ( unsigned long long )hi << 32 ) | lo;
+#else
+    return 0;
+#endif
+}
+
+inline cpu_features probe_cpu()
+{
+    cpu_features f;
+    unsigned r[4];
+
+    cpuid( 0, 0, r );
+    unsigned max_leaf = r[0];
+    if ( max_leaf < 1 ) {
+        return f;
+    }
+
+    cpuid( 1, 0, r );
+    f.sse42 = r[2] >> 20 & 1;
+
+    bool osxsave = r[2] >> 27 & 1;
+    bool avx     = r[2] >> 28 & 1;
+    unsigned long long xcr0 = osxsave ? xgetbv() : 0;
+    bool ymm = ( xcr0 & 0x06 ) == 0x06;
+    bool zmm = ( xcr0 & 0xe6 ) == 0xe6;
+
+    if ( max_leaf >= 7 ) {
+        cpuid( 7, 0, r );
+        f.avx2    = avx && ymm && ( r[1] >> 5 & 1 );
+        f.avx512f = avx && zmm && ( r[1] >> 16 & 1 );
+    }
+    return f;
+}
+} // impl
+
+/// \brief   features of the host CPU, probed by `CPUID` on the first call.
+inline cpu_features const& cpu()
+{
+    static cpu_features const features = impl::probe_cpu();
+    return features;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  BACKENDS
+//
+//  A backend tag tells if the compiler can emit its code (`buildable`)
+//  and if the host can run it (`supported()`).
+
+namespace isa
+{
+struct scalar
+{
+    enum { buildable = true };
+    static bool supported() { return true; }
+    static constexpr std::string_view name = "scalar";
+};
+
+struct sse42
+{
+    enum { buildable = MIND_X86 };
+    static bool supported() { return cpu().sse42; }
+    static constexpr std::string_view name = "sse4.2";
+};
+
+struct avx2
+{
+    enum { buildable = MIND_X86 };
+    static bool supported() { return cpu().avx2; }
+    static constexpr std::string_view name = "avx2";
+};
+
+struct avx512f
+{
+    enum { buildable = MIND_X86 };
+    static bool supported() { return cpu().avx512f; }
+    static constexpr std::string_view name = "avx512f";
+};
+} // isa
+
+template<class Isa> struct is_buildable { enum { value = Isa::buildable }; };
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  DISPATCH
+
+template<template<class> class Kernel, class TList> class dispatch;
+
+/*!
+\class   `dispatch<template<class> class Kernel, list<Isa...>>`
+\brief   calls `Kernel<Isa>::run` of the first backend the host supports.
+
+\tparam  Kernel  kernel template specialized for every backend, all the
+                 specializations have a static `run` of the same type.
+\tparam  Isa     backend tags in order of preference, those which can not
+                 be compiled are dropped by `select_t<is_buildable, ...>`.
+
+\details The function pointer starts at a resolver, the first call probes
+         the CPU and replaces it. Every later call is one load and one
+         indirect call.
+         Usage: `dispatch<sum_kernel, list<isa::avx2, isa::scalar>>::run( p, n );`
+*/
+template<template<class> class Kernel, class... Isa>
+class dispatch<Kernel, list<Isa...>>
+{
+public:
+
+    $def select_t<is_buildable, list<Isa...>> backends;
+
+private:
+
+    template<class... Bs> struct first { $def void type; };
+    template<class B, class... Bs> struct first<B, Bs...> { $def B type; };
+
+    $def typename apply<first, backends>::type fallback;
+
+    static_assert( !std::is_void_v<fallback>,
+                   "mind::dispatch: none of the backends can be compiled" );
+
+    $def decltype( &Kernel<fallback>::run ) function;
+
+    template<class... Bs>
+    static function choose( list<Bs...> )
+    {
+        static_assert( ( std::is_same_v<decltype( &Kernel<Bs>::run ), function> && ... ),
+                       "mind::dispatch: kernels differ in signature" );
+
+        function chosen = nullptr;
+        ( ( chosen = !chosen && Bs::supported() ? &Kernel<Bs>::run : chosen ), ... );
+        return chosen ? chosen : &Kernel<fallback>::run;
+    }
+
+    template<class... Bs>
+    static std::string_view name_of( function f, list<Bs...> )
+    {
+        std::string_view name;
+        ( ( name = f == &Kernel<Bs>::run ? Bs::name : name ), ... );
+        return name;
+    }
+
+    template<class R, class... Args>
+    static R resolve( Args... args )
+    {
+        function f = choose( backends{} );
+        slot_.store( f, std::memory_order_relaxed );
+        return f( args... );
+    }
+
+    template<class R, class... Args>
+    static constexpr function resolver( R ( * )( Args... ) )
+    {
+        return &resolve<R, Args...>;
+    }
+
+    static inline std::atomic<function> slot_{ resolver( function{} ) };
+
+public:
+
+    /// \brief   call the kernel of the best backend.
+    template<class... Args>
+    static decltype( auto ) run( Args &&... args )
+    {
+        return slot_.load( std::memory_order_relaxed )(
+            std::forward<Args>( args )... );
+    }
+
+    /// \brief   pointer to the chosen kernel, forces resolution.
+    static function get()
+    {
+        function f = choose( backends{} );
+        slot_.store( f, std::memory_order_relaxed );
+        return f;
+    }
+
+    /// \brief   name of the chosen backend.
+    static std::string_view active() { return name_of( get(), backends{} ); }
+};
+} // mind
@@ -0,0 +1,452 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   mind_injector.hpp
+/// \brief  compile-time dependency injection of singletons
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include <array>
+#include <cstddef>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "mind_core.hpp"
+
+namespace mind
+{
+////////////////////////////////////////////////////////////////////////////////
+// Binding: `Key` is resolved to the singleton of type `Impl`
+
+template<class Key, class Impl = Key> struct bind {};
+
+////////////////////////////////////////////////////////////////////////////////
+// Constructor probing
+//
+// Unlike `ctor_trait_t` the injector does not reap argument types, it only
+// asks which of the bound keys fits every constructor position. That keeps
+// the trait free of friend injection and stable across compilers.
+
+namespace impl
+{
+template<class T> struct binding_of { $def bind<T, T> type; };
+
+template<class Key, class Impl>
+struct binding_of<bind<Key, Impl>> { $def bind<Key, Impl> type; };
+
+template<class Binding> struct binding_traits;
+
+template<class Key, class Impl>
+struct binding_traits<bind<Key, Impl>>
+{
+    static_assert( std::is_base_of_v<Key, Impl> || std::is_same_v<Key, Impl>,
+                   "mind::injector: bound implementation must derive from its key" );
+
+    $def Key  key;
+    $def Impl impl;
+};
+
+// fits any argument but a copy of the type under construction
+template<class T> struct any_arg
+{
+    template<class U,
+             class = std::enable_if_t<!std::is_same_v<std::decay_t<U>, T>>
+             >
+    operator U &() const;
+};
+
+// fits only arguments initialized from `Key&`
+template<class Key> struct only_arg
+{
+    operator Key &() const;
+};
+
+// as `only_arg`, but a copy of the key is deleted: fails on parameters
+// taken by value, an abstract key can not be taken by value at all
+template<class Key, bool = std::is_abstract_v<Key>> struct ref_arg
+{
+    operator Key &() const;
+    operator Key() const = delete;
+};
+
+template<class Key> struct ref_arg<Key, true> : only_arg<Key> {};
+
+template<class T, class Key, size_t Pos, size_t Id>
+using probe_t = if_else_t<Pos == Id, only_arg<Key>, any_arg<T>>;
+
+template<class T, class Key, size_t Pos, size_t Id>
+using ref_probe_t = if_else_t<Pos == Id, ref_arg<Key>, any_arg<T>>;
+
+template<class T, size_t Id> using wildcard_t = any_arg<T>;
+
+template<class T, size_t... Ids>
+constexpr bool accepts_any( std::index_sequence<Ids...> )
+{
+    return std::is_constructible_v<T, wildcard_t<T, Ids>...>;
+}
+
+template<class T, class Key, size_t Pos, size_t... Ids>
+constexpr bool accepts_at( std::index_sequence<Ids...> )
+{
+    return std::is_constructible_v<T, probe_t<T, Key, Pos, Ids>...>;
+}
+
+// `true` if every resolved argument `Args` binds to a reference
+template<class T, class Args, class Ids> struct by_reference;
+
+template<class T, class... Args, size_t... Pos>
+struct by_reference<T, list<Args...>, std::index_sequence<Pos...>>
+{
+    template<class Key, size_t At, size_t... Ids>
+    static constexpr bool at( std::index_sequence<Ids...> )
+    {
+        if constexpr ( std::is_void_v<Key> )
+            return true;
+        else
+            return std::is_constructible_v<T, ref_probe_t<T, Key, At, Ids>...>;
+    }
+
+    enum
+    {
+        value = ( at<Args, Pos>( std::index_sequence_for<Args...>{} ) && ... )
+    };
+};
+
+// arity of the widest constructor, `size_t( -1 )` if there is none
+template<class T, size_t MaxArgs>
+constexpr size_t arity()
+{
+    if constexpr ( accepts_any<T>( std::make_index_sequence<MaxArgs>{} ) )
+        return MaxArgs;
+    else if constexpr ( MaxArgs == 0 )
+        return size_t( -1 );
+    else
+        return arity<T, MaxArgs - 1>();
+}
+
+// unresolved arguments are marked by `void`
+template<class T, size_t Arity, size_t Pos, class... Keys>
+struct arg_at
+{
+    // a binding never depends on itself, the copy constructor of `T`
+    // would otherwise take its own key
+    static constexpr bool fits[] = {
+        ( !std::is_base_of_v<Keys, T> && !std::is_same_v<Keys, T>
+          && accepts_at<T, Keys, Pos>( std::make_index_sequence<Arity>{} ) )...,
+        true
+    };
+
+    static constexpr size_t index()
+    {
+        size_t i = 0;
+        while ( !fits[i] ) {
+            ++i;
+        }
+        return i;
+    }
+
+    $def std::tuple_element_t<index(), std::tuple<Keys..., void>> type;
+};
+
+template<class T, size_t Arity, class Keys, class Ids> struct args_of;
+
+template<class T, size_t Arity, class... Keys, size_t... Pos>
+struct args_of<T, Arity, list<Keys...>, std::index_sequence<Pos...>>
+{
+    $def list<typename arg_at<T, Arity, Pos, Keys...>::type...> type;
+};
+
+template<class T, class Keys, size_t MaxArgs>
+struct dependencies
+{
+    static constexpr size_t arity = impl::arity<T, MaxArgs>();
+
+    static_assert( arity <= MaxArgs,
+                   "mind::injector: bound type has no usable constructor" );
+
+    $type args_of<
+        T, arity, Keys, std::make_index_sequence<arity <= MaxArgs ? arity : 0>
+        >::type type;
+
+    static_assert( !is_member_v<void, type>,
+                   "mind::injector: constructor argument is not bound" );
+
+    static_assert( by_reference<
+                       T, type, std::make_index_sequence<length_v<type>>>::value,
+                   "mind::injector: a bound key must be taken by reference, "
+                   "not by value" );
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Construction schedule (Kahn's algorithm over an adjacency matrix)
+
+template<size_t N>
+struct schedule
+{
+    std::array<size_t, N> order{};
+    size_t length = 0;
+};
+
+// `depends[i * N + j]` is `true` if the binding `i` needs the binding `j`
+template<size_t N>
+constexpr schedule<N> topological_order( std::array<bool, N * N> depends )
+{
+    schedule<N> s{};
+    std::array<size_t, N> pending{};
+
+    for ( size_t i = 0; i < N; ++i ) {
+        for ( size_t j = 0; j < N; ++j ) {
+            pending[i] += depends[i * N + j];
+        }
+        if ( pending[i] == 0 ) {
+            s.order[s.length++] = i;
+        }
+    }
+
+    for ( size_t head = 0; head < s.length; ++head ) {
+        size_t ready = s.order[head];
+
+        for ( size_t i = 0; i < N; ++i ) {
+            if ( depends[i * N + ready] && --pending[i] == 0 ) {
+                s.order[s.length++] = i;
+            }
+        }
+    }
+    return s;
+}
+
+// a binding on a cycle, `N` if all are scheduled: every unscheduled
+// binding waits on another unscheduled one, so following those edges
+// from any of them repeats a binding after at most `N` steps
+template<size_t N>
+constexpr size_t on_cycle( std::array<bool, N * N> depends, schedule<N> s )
+{
+    std::array<bool, N> done{};
+
+    for ( size_t i = 0; i < s.length; ++i ) {
+        done[s.order[i]] = true;
+    }
+
+    size_t at = 0;
+    while ( at < N && done[at] ) {
+        ++at;
+    }
+    for ( size_t step = 0; at < N && step < N; ++step ) {
+        size_t next = 0;
+        while ( done[next] || !depends[at * N + next] ) {
+            ++next;
+        }
+        at = next;
+    }
+    return at;
+}
+
+// named after the key, so the compiler points at the culprit
+template<class Key, bool Acyclic>
+struct dependency_cycle_through
+{
+    static_assert( Acyclic,
+                   "mind::injector: bindings form a dependency cycle" );
+
+    enum { value = Acyclic };
+};
+
+template<class Key>
+struct dependency_cycle_through<Key, true> { enum { value = true }; };
+} // impl
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  INJECTOR
+
+template<class TList, size_t MaxArgs = 10> class injector;
+
+/*!
+\class   `injector<list<Bindings...>, size_t MaxArgs>`
+\brief   owns one instance of every binding and wires them by constructors.
+
+\tparam  Bindings  either a type `T` or `bind<Key, Impl>`.
+\tparam  MaxArgs   the widest constructor considered.
+
+\details The dependency graph is deduced from the widest constructor of every
+         implementation, whose arguments must be references to bound keys.
+         Singletons are built in a topological order inside one contiguous
+         arena and destroyed in reverse. `get<Key>()` is a fixed offset from
+         `this`, no lookup is done at runtime.
+         Usage: `injector<list<config, bind<storage, disk_storage>>> app;`
+                `app.get<storage>().flush();`
+*/
+template<class... Bindings, size_t MaxArgs>
+class injector<list<Bindings...>, MaxArgs>
+{
+    template<class B> using key_t  = typename impl::binding_traits<B>::key;
+    template<class B> using impl_t = typename impl::binding_traits<B>::impl;
+
+    $def list<key_t<typename impl::binding_of<Bindings>::type>...> keys;
+    $def std::tuple<impl_t<typename impl::binding_of<Bindings>::type>...> impls;
+
+    static constexpr size_t count = sizeof...( Bindings );
+
+    static_assert( length_v<unique_t<keys>> == count,
+                   "mind::injector: a key is bound more than once" );
+
+    template<size_t I> using impl_at = std::tuple_element_t<I, impls>;
+
+    template<size_t I>
+    using deps_at =
+        typename impl::dependencies<impl_at<I>, keys, MaxArgs>::type;
+
+    template<class... Ds>
+    static constexpr void mark( [[maybe_unused]] bool *row, list<Ds...> )
+    {
+        ( ( row[index_of_v<Ds, keys>] = true ), ... );
+    }
+
+    template<size_t... Is>
+    static constexpr std::array<bool, count * count>
+    graph( std::index_sequence<Is...> )
+    {
+        std::array<bool, count * count> depends{};
+        ( mark( depends.data() + Is * count, deps_at<Is>{} ), ... );
+        return depends;
+    }
+
+    static constexpr std::array<bool, count * count> depends =
+        graph( std::make_index_sequence<count>{} );
+
+    static constexpr impl::schedule<count> plan =
+        impl::topological_order<count>( depends );
+
+    $def std::tuple_element_t<
+        impl::on_cycle<count>( depends, plan ),
+        std::tuple<key_t<typename impl::binding_of<Bindings>::type>..., void>
+        > cyclic_key;
+
+    static_assert( impl::dependency_cycle_through<
+                       cyclic_key, plan.length == count>::value );
+
+    template<size_t... Is>
+    static constexpr std::array<size_t, count + 1>
+    layout( std::index_sequence<Is...> )
+    {
+        constexpr size_t size[]  = { sizeof( impl_at<Is> )..., 0 };
+        constexpr size_t align[] = { alignof( impl_at<Is> )..., 1 };
+
+        // offsets by binding index, the total size goes last
+        std::array<size_t, count + 1> offset{};
+        size_t top = 0;
+
+        for ( size_t step = 0; step < count; ++step ) {
+            size_t i = plan.order[step];
+            top       = ( top + align[i] - 1 ) / align[i] * align[i];
+            offset[i] = top;
+            top      += size[i];
+        }
+        offset[count] = top;
+        return offset;
+    }
+
+    static constexpr std::array<size_t, count + 1> offsets =
+        layout( std::make_index_sequence<count>{} );
+
+    template<size_t... Is>
+    static constexpr size_t max_align( std::index_sequence<Is...> )
+    {
+        size_t result = alignof( std::max_align_t );
+        ( ( result = alignof( impl_at<Is> ) > result
+                     ? alignof( impl_at<Is> ) : result ), ... );
+        return result;
+    }
+
+public:
+
+    injector()
+    {
+        build( std::make_index_sequence<count>{} );
+    }
+
+    ~injector()
+    {
+        destroy( std::make_index_sequence<count>{} );
+    }
+
+    injector( injector const & )            = delete;
+    injector& operator=( injector const & ) = delete;
+
+    /// \brief   reference to the singleton bound to `Key`.
+    template<class Key>
+    Key& get() noexcept
+    {
+        constexpr size_t i = index_of_v<Key, keys>;
+        static_assert( i < count, "mind::injector: key is not bound" );
+
+        return *std::launder(
+            reinterpret_cast<impl_at<i> *>( arena_ + offsets[i] ) );
+    }
+
+    template<class Key>
+    Key const& get() const noexcept
+    {
+        return const_cast<injector *>( this )->template get<Key>();
+    }
+
+private:
+
+    template<size_t I, class... Ds>
+    void emplace( list<Ds...> )
+    {
+        ::new ( static_cast<void *>( arena_ + offsets[I] ) )
+        impl_at<I>( get<Ds>()... );
+        ++built_;
+    }
+
+    template<size_t... Steps>
+    void build( std::index_sequence<Steps...> )
+    {
+        try {
+            ( emplace<plan.order[Steps]>( deps_at<plan.order[Steps]>{} ), ... );
+        }
+        catch ( ... ) {
+            destroy( std::make_index_sequence<count>{} );
+            throw;
+        }
+    }
+
+    template<size_t I>
+    void release()
+    {
+        std::launder( reinterpret_cast<impl_at<I> *>( arena_ + offsets[I] ) )
+        ->~impl_at<I>();
+    }
+
+    // reverse construction order, only what has been built
+    template<size_t... Steps>
+    void destroy( std::index_sequence<Steps...> )
+    {
+        ( ( count - 1 - Steps < built_
+            ? release<plan.order[count - 1 - Steps]>() : void() ), ... );
+        built_ = 0;
+    }
+
+    alignas( max_align( std::make_index_sequence<count>{} ) )
+    std::byte arena_[offsets[count] > 0 ? offsets[count] : 1];
+    size_t built_ = 0;
+};
+} // mind
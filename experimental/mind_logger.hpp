@@ -0,0 +1,640 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   mind_logger.hpp
+/// \brief  structured logging with compile-time schemas of records
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "mind_core.hpp"
+#include "mind_slots.hpp"
+#include "mind_util.hpp"
+
+namespace mind
+{
+////////////////////////////////////////////////////////////////////////////////
+//
+//  LOG SITE
+//
+//  Everything known about a log statement at compile time: the format with
+//  `{name}` placeholders, the names, `type_name` and layout of the fields.
+
+enum class field_kind : uint8_t
+{
+    i8, i16, i32, i64, u8, u16, u32, u64, f32, f64, boolean, character, bytes
+};
+
+namespace impl
+{
+template<class T>
+constexpr field_kind kind_of()
+{
+    using std::is_same_v;
+    using std::is_signed_v;
+
+    if constexpr ( std::is_enum_v<T> )
+        return kind_of<std::underlying_type_t<T>>();
+    else if constexpr ( is_same_v<T, bool> )
+        return field_kind::boolean;
+    else if constexpr ( is_same_v<T, char> )
+        return field_kind::character;
+    else if constexpr ( is_same_v<T, float> )
+        return field_kind::f32;
+    else if constexpr ( is_same_v<T, double> )
+        return field_kind::f64;
+    else if constexpr ( std::is_integral_v<T> && sizeof( T ) == 1 )
+        return is_signed_v<T> ? field_kind::i8 : field_kind::u8;
+    else if constexpr ( std::is_integral_v<T> && sizeof( T ) == 2 )
+        return is_signed_v<T> ? field_kind::i16 : field_kind::u16;
+    else if constexpr ( std::is_integral_v<T> && sizeof( T ) == 4 )
+        return is_signed_v<T> ? field_kind::i32 : field_kind::u32;
+    else if constexpr ( std::is_integral_v<T> && sizeof( T ) == 8 )
+        return is_signed_v<T> ? field_kind::i64 : field_kind::u64;
+    else
+        return field_kind::bytes;
+}
+
+// bytes of a field of `kind`, 0 if it has no fixed width
+constexpr size_t width_of( field_kind kind )
+{
+    switch ( kind ) {
+    case field_kind::i8:  case field_kind::u8:
+    case field_kind::boolean: case field_kind::character: return 1;
+    case field_kind::i16: case field_kind::u16: return 2;
+    case field_kind::i32: case field_kind::u32: case field_kind::f32: return 4;
+    case field_kind::i64: case field_kind::u64: case field_kind::f64: return 8;
+    case field_kind::bytes: break;
+    }
+    return 0;
+}
+} // impl
+
+struct log_site
+{
+    static constexpr size_t max_fields = 16;
+
+    std::string_view format;
+    size_t fields = 0; // number of placeholders
+    size_t size   = 0; // bytes of the arguments
+    std::array<std::string_view, max_fields> names{};
+    std::array<std::string_view, max_fields> types{};
+    std::array<field_kind, max_fields> kinds{};
+    std::array<uint32_t, max_fields> sizes{};
+};
+
+template<class TList> struct log_schema;
+
+/*!
+\class   `log_schema<list<Ts...>>`
+\brief   builds the `log_site` of a statement with arguments `Ts...`.
+
+\details `make` runs at compile time, it counts the placeholders of the
+         format and takes the names from them.
+*/
+template<class... Ts>
+struct log_schema<list<Ts...>>
+{
+    static_assert( ( std::is_trivially_copyable_v<Ts> && ... ),
+                   "mind::log: arguments must be trivially copyable" );
+    static_assert( sizeof...( Ts ) <= log_site::max_fields,
+                   "mind::log: too many arguments" );
+
+    static constexpr log_site make( std::string_view format )
+    {
+        log_site site;
+        site.format = format;
+        site.size   = ( sizeof( Ts ) + ... + 0 );
+
+        std::string_view types[] = { type_name<Ts>()..., "" };
+        field_kind kinds[]       = { impl::kind_of<Ts>()..., field_kind::bytes };
+        uint32_t sizes[]         = { uint32_t( sizeof( Ts ) )..., 0 };
+
+        for ( size_t i = 0; i < sizeof...( Ts ); ++i ) {
+            site.types[i] = types[i];
+            site.kinds[i] = kinds[i];
+            site.sizes[i] = sizes[i];
+        }
+
+        for ( size_t at = 0; at < format.size(); ++at ) {
+            if ( format[at] != '{' ) {
+                continue;
+            }
+
+            size_t end = format.find( '}', at );
+            if ( end == std::string_view::npos ) {
+                break;
+            }
+            if ( site.fields < log_site::max_fields ) {
+                site.names[site.fields] = format.substr( at + 1, end - at - 1 );
+            }
+            ++site.fields;
+            at = end;
+        }
+        return site;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  FORMATTING
+
+namespace impl
+{
+template<class T>
+void print_as( std::ostream &out, char const *p )
+{
+    T v;
+    std::memcpy( &v, p, sizeof( T ) );
+    out << v;
+}
+
+inline void print_field( std::ostream &out, field_kind kind,
+                         char const *p, size_t size )
+{
+    switch ( kind ) {
+    case field_kind::i8:        out << int( int8_t( *p ) );  break;
+    case field_kind::u8:        out << unsigned( uint8_t( *p ) ); break;
+    case field_kind::i16:       print_as<int16_t>( out, p );  break;
+    case field_kind::u16:       print_as<uint16_t>( out, p ); break;
+    case field_kind::i32:       print_as<int32_t>( out, p );  break;
+    case field_kind::u32:       print_as<uint32_t>( out, p ); break;
+    case field_kind::i64:       print_as<int64_t>( out, p );  break;
+    case field_kind::u64:       print_as<uint64_t>( out, p ); break;
+    case field_kind::f32:       print_as<float>( out, p );    break;
+    case field_kind::f64:       print_as<double>( out, p );   break;
+    case field_kind::boolean:   out << ( *p ? "true" : "false" ); break;
+    case field_kind::character: out << *p; break;
+    case field_kind::bytes:
+        static char const hex[] = "0123456789abcdef";
+        out << "0x";
+        for ( size_t i = 0; i < size; ++i ) {
+            out << hex[uint8_t( p[i] ) >> 4] << hex[uint8_t( p[i] ) & 15];
+        }
+        break;
+    }
+}
+} // impl
+
+/// \brief   write one record as text: the time and the format with
+///          the placeholders replaced by the values.
+inline void format_record( std::ostream &out, log_site const &site,
+                           uint64_t time, char const *payload )
+{
+    out << '[' << time << "] ";
+
+    size_t field = 0;
+    for ( size_t at = 0; at < site.format.size(); ++at ) {
+        size_t end = site.format[at] == '{' ? site.format.find( '}', at )
+                                            : std::string_view::npos;
+        if ( end == std::string_view::npos || field >= site.fields ) {
+            out << site.format[at];
+            continue;
+        }
+
+        impl::print_field( out, site.kinds[field], payload, site.sizes[field] );
+        payload += site.sizes[field++];
+        at = end;
+    }
+    out << '\n';
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  LOG RING
+
+/*!
+\class   `log_ring`
+\brief   single producer, single consumer ring of records.
+
+\details A record is a `header` and the raw bytes of the arguments, padded
+         to 8 bytes. A record never wraps: the tail of the buffer is skipped
+         by a header without a site, or silently if even a header does not
+         fit there. A full ring drops the record and counts it.
+*/
+class log_ring
+{
+public:
+
+    struct header
+    {
+        log_site const *site;
+        uint64_t time;
+        uint64_t size; // whole record, header included
+    };
+
+    // the capacity is rounded up to a power of two
+    explicit log_ring( size_t capacity )
+        : mask_( round_up( capacity ) - 1 )
+    {
+        data_.reset( new char[mask_ + 1] );
+    }
+
+    char* reserve( size_t size )
+    {
+        uint64_t head = head_.load( std::memory_order_relaxed );
+        uint64_t used = head - tail_.load( std::memory_order_acquire );
+        size_t rest   = mask_ + 1 - ( head & mask_ );
+        size_t skip   = rest < size ? rest : 0;
+
+        if ( used + skip + size > mask_ + 1 ) {
+            dropped_.fetch_add( 1, std::memory_order_relaxed );
+            return nullptr;
+        }
+        if ( skip >= sizeof( header ) ) {
+            header pad{ nullptr, 0, skip };
+            std::memcpy( data_.get() + ( head & mask_ ), &pad, sizeof( pad ) );
+        }
+        if ( skip ) {
+            // release, `drain` may see the skip before the next commit
+            head_.store( head + skip, std::memory_order_release );
+            head += skip;
+        }
+        return data_.get() + ( head & mask_ );
+    }
+
+    void commit( size_t size )
+    {
+        head_.store( head_.load( std::memory_order_relaxed ) + size,
+                     std::memory_order_release );
+    }
+
+    /// \brief   call `f( header const &, char const *payload )` on every
+    ///          committed record and release it.
+    template<class F>
+    size_t drain( F &&f )
+    {
+        uint64_t tail = tail_.load( std::memory_order_relaxed );
+        uint64_t head = head_.load( std::memory_order_acquire );
+        size_t count  = 0;
+
+        while ( tail != head ) {
+            size_t rest = mask_ + 1 - ( tail & mask_ );
+            if ( rest < sizeof( header ) ) {
+                tail += rest;
+                continue;
+            }
+
+            header h;
+            std::memcpy( &h, data_.get() + ( tail & mask_ ), sizeof( h ) );
+            if ( h.site ) {
+                f( h, data_.get() + ( tail & mask_ ) + sizeof( h ) );
+                ++count;
+            }
+            tail += h.size;
+        }
+        tail_.store( tail, std::memory_order_release );
+        return count;
+    }
+
+    uint64_t dropped() const { return dropped_.load( std::memory_order_relaxed ); }
+
+private:
+
+    static size_t round_up( size_t n )
+    {
+        size_t p = 64;
+        while ( p < n ) {
+            p *= 2;
+        }
+        return p;
+    }
+
+    std::unique_ptr<char[]> data_;
+    size_t mask_;
+
+    alignas( 64 ) std::atomic<uint64_t> head_{ 0 };
+    alignas( 64 ) std::atomic<uint64_t> tail_{ 0 };
+    alignas( 64 ) std::atomic<uint64_t> dropped_{ 0 };
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  LOGGER
+
+/*!
+\class   `logger`
+\brief   a ring per thread and a background thread which writes them out.
+
+\details `write` copies the arguments into the ring of the calling thread,
+         nothing is formatted or allocated there. The background thread
+         writes text, or a binary stream for `log_decoder` if the logger
+         is `binary`. The ring of a thread is made on its first record and
+         goes back to the logger when the thread exits, a new thread takes
+         it over with whatever is not written out yet.
+         Usage: `MIND_LOG( log, "user {id} took {ms} ms", id, ms );`
+*/
+class logger
+{
+public:
+
+    enum mode { text, binary };
+
+    explicit logger( std::ostream &out, mode m = text,
+                     size_t ring_bytes = 1 << 16 )
+        : out_{ out }, mode_{ m }, ring_bytes_{ ring_bytes }
+    {
+        static_assert( sizeof( log_ring::header ) % 8 == 0 );
+
+        if ( mode_ == binary ) {
+            out_.write( "MINDLOG1", 8 );
+        }
+        worker_ = std::thread( [this] { consume(); } );
+    }
+
+    ~logger()
+    {
+        stop_.store( true, std::memory_order_release );
+        worker_.join();
+        drain();
+        out_.flush();
+    }
+
+    logger( logger const & )            = delete;
+    logger& operator=( logger const & ) = delete;
+
+    template<class... Ts>
+    void write( log_site const &site, Ts const &... args )
+    {
+        constexpr size_t payload = ( sizeof( Ts ) + ... + 0 );
+        constexpr size_t size    = ( sizeof( log_ring::header ) + payload + 7 ) / 8 * 8;
+
+        log_ring &r = local_ring();
+        char *p     = r.reserve( size );
+        if ( !p ) {
+            return;
+        }
+
+        log_ring::header h{
+            &site,
+            uint64_t( std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now().time_since_epoch() )
+                      .count() ),
+            size
+        };
+        std::memcpy( p, &h, sizeof( h ) );
+        p += sizeof( h );
+        ( ( std::memcpy( p, &args, sizeof( Ts ) ), p += sizeof( Ts ) ), ... );
+        r.commit( size );
+    }
+
+    /// \brief   block until every record written so far is out.
+    void flush()
+    {
+        std::lock_guard<std::mutex> lock( drain_ );
+        drain_locked();
+        out_.flush();
+    }
+
+    /// \brief   number of rings, at most the threads ever logging at once.
+    size_t rings() const { return rings_.size(); }
+
+    uint64_t dropped()
+    {
+        uint64_t n = 0;
+        for ( log_ring *r : rings_.all() ) {
+            n += r->dropped();
+        }
+        return n;
+    }
+
+private:
+
+    log_ring& local_ring()
+    {
+        return rings_.local( [this] {
+            return std::make_unique<log_ring>( ring_bytes_ );
+        } );
+    }
+
+    void consume()
+    {
+        while ( !stop_.load( std::memory_order_acquire ) ) {
+            if ( drain() == 0 ) {
+                std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+            }
+        }
+    }
+
+    size_t drain()
+    {
+        std::lock_guard<std::mutex> lock( drain_ );
+        return drain_locked();
+    }
+
+    size_t drain_locked()
+    {
+        size_t count = 0;
+        for ( log_ring *r : rings_.all() ) {
+            count += r->drain( [this]( log_ring::header const &h, char const *p ) {
+                if ( mode_ == text ) {
+                    format_record( out_, *h.site, h.time, p );
+                }
+                else {
+                    emit( h, p );
+                }
+            } );
+        }
+        return count;
+    }
+
+    void put_string( std::string_view s )
+    {
+        uint32_t n = uint32_t( s.size() );
+        out_.write( reinterpret_cast<char const *>( &n ), sizeof( n ) );
+        out_.write( s.data(), n );
+    }
+
+    template<class T> void put( T v )
+    {
+        out_.write( reinterpret_cast<char const *>( &v ), sizeof( v ) );
+    }
+
+    // a site is described once, then records refer to it by number
+    void emit( log_ring::header const &h, char const *p )
+    {
+        auto found = sites_.find( h.site );
+        if ( found == sites_.end() ) {
+            found = sites_.emplace( h.site, uint32_t( sites_.size() ) ).first;
+
+            log_site const &s = *h.site;
+            put( 'S' );
+            put( found->second );
+            put_string( s.format );
+            put( uint32_t( s.fields ) );
+            for ( size_t i = 0; i < s.fields && i < log_site::max_fields; ++i ) {
+                put_string( s.names[i] );
+                put_string( s.types[i] );
+                put( s.kinds[i] );
+                put( s.sizes[i] );
+            }
+        }
+
+        put( 'E' );
+        put( found->second );
+        put( h.time );
+        put( uint32_t( h.site->size ) );
+        out_.write( p, std::streamsize( h.site->size ) );
+    }
+
+    std::ostream &out_;
+    mode mode_;
+    size_t ring_bytes_;
+    thread_slots<log_ring> rings_;
+
+    std::mutex drain_;
+    std::unordered_map<log_site const *, uint32_t> sites_;
+
+    std::atomic<bool> stop_{ false };
+    std::thread worker_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  LOG DECODER
+
+/// \brief   turn a binary log of `logger` into text, `false` if the stream
+///          is not a log, is cut short or has a field it cannot read.
+inline bool log_decoder( std::istream &in, std::ostream &out )
+{
+    struct owned_site
+    {
+        log_site site;
+        std::vector<std::string> strings;
+    };
+
+    auto get_string = [&in]( std::string &s ) {
+        uint32_t n = 0;
+        in.read( reinterpret_cast<char *>( &n ), sizeof( n ) );
+        s.resize( n );
+        in.read( s.data(), n );
+    };
+    auto get = [&in]( auto &v ) {
+        in.read( reinterpret_cast<char *>( &v ), sizeof( v ) );
+    };
+
+    char magic[8] = {};
+    in.read( magic, 8 );
+    if ( !in || std::string_view( magic, 8 ) != "MINDLOG1" ) {
+        return false;
+    }
+
+    std::vector<std::unique_ptr<owned_site>> sites;
+    std::vector<char> payload;
+    char tag;
+
+    while ( in.get( tag ) ) {
+        uint32_t id = 0;
+        get( id );
+
+        if ( tag == 'S' ) {
+            auto s = std::make_unique<owned_site>();
+            uint32_t fields = 0;
+
+            s->strings.resize( 1 + 2 * log_site::max_fields );
+            get_string( s->strings[0] );
+            get( fields );
+            if ( fields > log_site::max_fields ) {
+                return false;
+            }
+
+            s->site.fields = fields;
+            for ( size_t i = 0; i < fields; ++i ) {
+                get_string( s->strings[1 + 2 * i] );
+                get_string( s->strings[2 + 2 * i] );
+                get( s->site.kinds[i] );
+                get( s->site.sizes[i] );
+
+                // the payload is read by the kind, its size must fit it
+                field_kind kind = s->site.kinds[i];
+                size_t width    = impl::width_of( kind );
+                if ( kind > field_kind::bytes || s->site.sizes[i] == 0
+                     || ( width && s->site.sizes[i] != width ) ) {
+                    return false;
+                }
+                s->site.names[i] = s->strings[1 + 2 * i];
+                s->site.types[i] = s->strings[2 + 2 * i];
+                s->site.size    += s->site.sizes[i];
+            }
+            s->site.format = s->strings[0];
+
+            if ( id != sites.size() ) {
+                return false;
+            }
+            sites.push_back( std::move( s ) );
+        }
+        else if ( tag == 'E' && id < sites.size() ) {
+            uint64_t time = 0;
+            uint32_t size = 0;
+            get( time );
+            get( size );
+            if ( !in || size != sites[id]->site.size ) {
+                return false;
+            }
+            payload.resize( size );
+            in.read( payload.data(), size );
+            if ( !in ) {
+                return false;
+            }
+            format_record( out, sites[id]->site, time, payload.data() );
+        }
+        else {
+            return false;
+        }
+
+        if ( !in ) {
+            return false;
+        }
+    }
+    return true;
+}
+} // mind
+
+////////////////////////////////////////////////////////////////////////////////
+// Log statement, the site is a `static constexpr` of the call. The format is
+// the first of `...`, so a statement without arguments is valid ISO C++17.
+
+#define MIND_LOG_FORMAT_( format, ... ) format
+
+#define MIND_LOG( logger, ... )                                              \
+    ( [&]( auto const &, auto const &... mind_args_ ) {                      \
+        static constexpr ::mind::log_site mind_site_ =                       \
+            ::mind::log_schema<::mind::list<                                 \
+                std::decay_t<decltype( mind_args_ )>...>>::make(             \
+                    MIND_LOG_FORMAT_( __VA_ARGS__, 0 ) );                    \
+        static_assert( mind_site_.fields == sizeof...( mind_args_ ),         \
+                       "MIND_LOG: placeholders and arguments differ" );      \
+        ( logger ).write( mind_site_, mind_args_... );                       \
+    } ( __VA_ARGS__ ) )
@@ -0,0 +1,383 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   mind_parallel.hpp
+/// \brief  partition of type lists and parallel visit of tuples
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mind_core.hpp"
+
+namespace mind
+{
+////////////////////////////////////////////////////////////////////////////////
+//
+//  PARTITION, CHUNK
+
+// default cost of an element
+template<class T> struct unit_cost { enum : size_t { value = 1 }; };
+
+namespace impl
+{
+// bounds of `K` contiguous groups with the sums of costs as even as possible
+template<size_t K, size_t N>
+constexpr std::array<size_t, K + 1> split( std::array<size_t, N> cost )
+{
+    size_t total = 0;
+    for ( size_t i = 0; i < N; ++i ) {
+        total += cost[i];
+    }
+
+    // all sums are scaled by `K` to stay in integers
+    std::array<size_t, K + 1> bounds{};
+    size_t i      = 0;
+    size_t prefix = 0;
+
+    for ( size_t k = 1; k < K; ++k ) {
+        size_t target = total * k;
+
+        while ( i < N && prefix + cost[i] * K <= target ) {
+            prefix += cost[i++] * K;
+        }
+        if ( i < N && 2 * ( target - prefix ) > cost[i] * K ) {
+            prefix += cost[i++] * K;
+        }
+        bounds[k] = i;
+    }
+    bounds[K] = N;
+    return bounds;
+}
+
+template<$class Head, size_t Begin, class Tuple, size_t... Ids>
+$deduce slice( std::index_sequence<Ids...> )
+-> Head<std::tuple_element_t<Begin + Ids, Tuple>...>;
+
+template<$class Cost, size_t K, class TList> struct partition;
+
+template<$class Cost, size_t K, $class Head, class... Ts>
+struct partition<Cost, K, Head<Ts...>>
+{
+    static_assert( K > 0, "mind::partition: at least one group is required" );
+
+    static constexpr std::array<size_t, K + 1> bounds =
+        split<K, sizeof...( Ts )>( { size_t( Cost<Ts>::value )... } );
+
+    template<size_t I>
+    using group_t = decltype( slice<Head, bounds[I], std::tuple<Ts...>>(
+        std::make_index_sequence<bounds[I + 1] - bounds[I]>{} ) );
+
+    template<size_t... Is>
+    static $deduce groups( std::index_sequence<Is...> ) -> maybe<group_t<Is>...>;
+
+    $def decltype( groups( std::make_index_sequence<K>{} ) ) type;
+};
+} // impl
+
+/// \brief   `maybe` of `K` contiguous sub-lists of `TList` with balanced
+///          sums of `Cost<T>::value`. Some groups are empty if `K` exceeds
+///          the length of `TList`.
+template<$class Cost, size_t K, class TList>
+using partition_t = typename impl::partition<Cost, K, TList>::type;
+
+template<$class Cost, size_t K, class TList>
+struct partition { $def partition_t<Cost, K, TList> type; };
+
+/// \brief   `maybe` of `K` contiguous sub-lists of `TList` of almost equal
+///          length.
+template<size_t K, class TList>
+using chunk_t = partition_t<unit_cost, K, TList>;
+
+template<size_t K, class TList>
+struct chunk { $def chunk_t<K, TList> type; };
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  THREAD_POOL
+
+/*!
+\class   `thread_pool`
+\brief   fixed set of workers with a queue per worker and work stealing.
+
+\details A worker takes the newest task of its own queue and steals
+         the oldest one from the others. A task is a plain function pointer
+         with a context, nothing is allocated per task. The thread waiting
+         for a batch runs tasks too, so a pool of zero workers is valid.
+*/
+class thread_pool
+{
+public:
+
+    struct task
+    {
+        void (*run)( void *, size_t );
+        void *context;
+        size_t argument;
+        std::atomic<size_t> *pending;
+    };
+
+    explicit thread_pool( size_t workers = std::thread::hardware_concurrency() )
+    {
+        for ( size_t i = 0; i < workers; ++i ) {
+            queues_.emplace_back( std::make_unique<queue>() );
+        }
+        for ( size_t i = 0; i < workers; ++i ) {
+            threads_.emplace_back( [this, i] { work( i ); } );
+        }
+    }
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock( sleep_ );
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for ( auto &thread : threads_ ) {
+            thread.join();
+        }
+    }
+
+    thread_pool( thread_pool const & )            = delete;
+    thread_pool& operator=( thread_pool const & ) = delete;
+
+    size_t size() const { return threads_.size(); }
+
+    /// \brief   enqueue a task, the caller must `wait` on its `pending`.
+    void submit( task t )
+    {
+        if ( queues_.empty() ) {
+            std::lock_guard<std::mutex> lock( sleep_ );
+            overflow_.push_back( t );
+            return;
+        }
+
+        // counted first, so a worker never sees fewer tasks than queued
+        {
+            std::lock_guard<std::mutex> lock( sleep_ );
+            ++queued_;
+        }
+
+        queue &q = *queues_[next_++ % queues_.size()];
+        {
+            std::lock_guard<std::mutex> lock( q.mutex );
+            q.tasks.push_back( t );
+        }
+        wake_.notify_one();
+    }
+
+    /// \brief   run queued tasks until `pending` drops to zero.
+    void wait( std::atomic<size_t> &pending )
+    {
+        task t;
+        while ( pending.load( std::memory_order_acquire ) > 0 ) {
+            if ( take( queues_.size(), t ) ) {
+                execute( t );
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+
+    struct alignas( 64 ) queue
+    {
+        std::mutex mutex;
+        std::deque<task> tasks;
+    };
+
+    static void execute( task const &t )
+    {
+        t.run( t.context, t.argument );
+        t.pending->fetch_sub( 1, std::memory_order_acq_rel );
+    }
+
+    // own queue from the back, then the others from the front
+    bool take( size_t self, task &t )
+    {
+        size_t n = queues_.size();
+
+        if ( self < n ) {
+            queue &own = *queues_[self];
+            std::lock_guard<std::mutex> lock( own.mutex );
+            if ( !own.tasks.empty() ) {
+                t = own.tasks.back();
+                own.tasks.pop_back();
+                return taken();
+            }
+        }
+        for ( size_t i = 1; i <= n; ++i ) {
+            queue &victim = *queues_[( self + i ) % n];
+            std::lock_guard<std::mutex> lock( victim.mutex );
+            if ( !victim.tasks.empty() ) {
+                t = victim.tasks.front();
+                victim.tasks.pop_front();
+                return taken();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock( sleep_ );
+        if ( overflow_.empty() ) {
+            return false;
+        }
+        t = overflow_.front();
+        overflow_.pop_front();
+        return true;
+    }
+
+    bool taken()
+    {
+        std::lock_guard<std::mutex> lock( sleep_ );
+        --queued_;
+        return true;
+    }
+
+    void work( size_t self )
+    {
+        task t;
+        for ( ;; ) {
+            if ( take( self, t ) ) {
+                execute( t );
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock( sleep_ );
+            wake_.wait( lock, [this] { return stop_ || queued_ > 0; } );
+            if ( stop_ ) {
+                return;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<size_t> next_{ 0 };
+
+    std::mutex sleep_;
+    std::condition_variable wake_;
+    std::deque<task> overflow_; // used only without workers
+    size_t queued_ = 0;
+    bool stop_     = false;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  PARALLEL_FOR_EACH
+
+namespace impl
+{
+template<class Tuple, class F>
+struct visit_context
+{
+    Tuple &tuple;
+    F &f;
+    std::mutex mutex;
+    std::exception_ptr error;
+};
+
+template<size_t Begin, class Context, size_t... Ids>
+void visit_range( Context &ctx, std::index_sequence<Ids...> )
+{
+    ( ctx.f( std::get<Begin + Ids>( ctx.tuple ) ), ... );
+}
+
+template<class Bounds, class Context, size_t I>
+void visit_group( Context &ctx )
+{
+    constexpr size_t begin = Bounds::bounds[I];
+    constexpr size_t end   = Bounds::bounds[I + 1];
+
+    try {
+        visit_range<begin>( ctx, std::make_index_sequence<end - begin>{} );
+    }
+    catch ( ... ) {
+        std::lock_guard<std::mutex> lock( ctx.mutex );
+        if ( !ctx.error ) {
+            ctx.error = std::current_exception();
+        }
+    }
+}
+
+template<class Bounds, class Context, size_t... Is>
+void visit_groups( void *context, size_t group, std::index_sequence<Is...> )
+{
+    // one indirect call per group, the group itself is unrolled
+    static constexpr void (*table[])( Context & ) = {
+        &visit_group<Bounds, Context, Is>...
+    };
+    table[group]( *static_cast<Context *>( context ) );
+}
+} // impl
+
+/*!
+\brief   call `f` on every element of `tuple` on the workers of `pool`.
+
+\tparam  K     number of tasks, the tuple is split by `partition_t<Cost, K>`.
+               `0` means one task per element.
+\tparam  Cost  meta-function with `value`, relative cost of calling `f`
+               on an element of a given type.
+
+\details Blocks until all the elements are visited, the calling thread
+         helps the pool meanwhile. The first exception thrown by `f` is
+         rethrown after the rest of the groups has finished.
+*/
+template<size_t K = 0, $class Cost = unit_cost, class Tuple, class F>
+void parallel_for_each( Tuple &tuple, F &&f, thread_pool &pool )
+{
+    $def std::remove_cv_t<Tuple> plain;
+    $def apply<list, plain> types;
+
+    constexpr size_t groups = K > 0 ? K : ( length_v<types> > 0 ? length_v<types> : 1 );
+
+    $def impl::partition<Cost, groups, types> bounds;
+    $def impl::visit_context<Tuple, std::remove_reference_t<F>> context;
+
+    context ctx{ tuple, f, {}, {} };
+    std::atomic<size_t> pending{ groups };
+
+    for ( size_t i = 0; i < groups; ++i ) {
+        pool.submit( {
+            []( void *c, size_t group ) {
+                impl::visit_groups<bounds, context>(
+                    c, group, std::make_index_sequence<groups>{} );
+            },
+            &ctx, i, &pending
+        } );
+    }
+    pool.wait( pending );
+
+    if ( ctx.error ) {
+        std::rethrow_exception( ctx.error );
+    }
+}
+} // mind
@@ -0,0 +1,340 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   mind_pipeline.hpp
+/// \brief  stream processing with stages fused at compile time
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "mind_core.hpp"
+
+namespace mind
+{
+////////////////////////////////////////////////////////////////////////////////
+//
+//  STAGE KINDS
+//
+//  A stage derives from one of the tags:
+//  - `map_stage`      `Out operator()( In ) const`
+//  - `filter_stage`   `bool operator()( T const & ) const`, keeps `true`
+//  - `stateful_stage` `Out operator()( In )`, called in order of the input
+//  - `batch_stage`    `void operator()( std::vector<T> & )`, edits a batch
+//
+//  The first three work item by item and are fused into one loop.
+
+struct map_stage {};
+struct filter_stage {};
+struct stateful_stage {};
+struct batch_stage {};
+
+template<class S> struct is_map_stage
+{
+    enum { value = std::is_base_of_v<map_stage, S> };
+};
+
+template<class S> struct is_filter_stage
+{
+    enum { value = std::is_base_of_v<filter_stage, S> };
+};
+
+template<class S> struct is_stateful_stage
+{
+    enum { value = std::is_base_of_v<stateful_stage, S> };
+};
+
+template<class S> struct is_batch_stage
+{
+    enum { value = std::is_base_of_v<batch_stage, S> };
+};
+
+template<class S> struct is_fusable_stage
+{
+    enum
+    {
+        value = is_map_stage<S>::value || is_filter_stage<S>::value
+                || is_stateful_stage<S>::value
+    };
+};
+
+template<class S> struct is_stage
+{
+    enum { value = is_fusable_stage<S>::value || is_batch_stage<S>::value };
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  FUSE
+
+namespace impl
+{
+template<class Groups, class Open>
+struct close_group { $def append_t<Groups, Open> type; };
+
+template<class Groups>
+struct close_group<Groups, list<>> { $def Groups type; };
+
+template<class Groups, class Open, class... Ss>
+struct fuse
+{
+    $type close_group<Groups, Open>::type type;
+};
+
+template<class Groups, class Open, class S, class... Ss>
+struct fuse<Groups, Open, S, Ss...>
+{
+    $type $if<
+        is_fusable_stage<S>::value,
+        fuse<Groups, append_t<Open, S>, Ss...>,
+        fuse<join_t<typename close_group<Groups, Open>::type, maybe<list<S>>>,
+             list<>, Ss...>
+        >::type type;
+};
+} // impl
+
+/// \brief   `maybe` of groups of stages, adjacent item-wise stages share
+///          a group and every batch stage is a group of its own.
+template<class TList>
+using fuse_t =
+    typename mind::apply<impl::fuse, join_t<list<maybe<>, list<>>, TList>>::type;
+
+template<class TList> struct fuse { $def fuse_t<TList> type; };
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  PIPELINE
+
+template<class TList, size_t BatchBytes = 32 * 1024> class pipeline;
+
+/*!
+\class   `pipeline<list<Stages...>, size_t BatchBytes>`
+\brief   chain of stages run over the input batch by batch.
+
+\tparam  Stages      stage types, see `STAGE KINDS`.
+\tparam  BatchBytes  budget of a batch of input, by default a L1 cache.
+
+\details Stages are grouped by `fuse_t`. A group of item-wise stages is one
+         loop with the stages inlined into its body, a buffer is only
+         written between groups.
+         Usage: `pipeline<list<parse, is_valid, scale>> p;`
+                `p.run( data, size, [&]( auto v ) { out.push_back( v ); } );`
+*/
+template<class... Stages, size_t BatchBytes>
+class pipeline<list<Stages...>, BatchBytes>
+{
+    static_assert( all_true_v<is_stage, list<Stages...>>,
+                   "mind::pipeline: a stage must derive from a stage kind" );
+
+public:
+
+    $def fuse_t<list<Stages...>> groups;
+    $def select_t<is_batch_stage, list<Stages...>> batch_stages;
+
+    pipeline() = default;
+
+    explicit pipeline( Stages... stages ) : stages_{ std::move( stages )... } {}
+
+    template<class S> S& stage() { return std::get<S>( stages_ ); }
+
+    /// \brief   pass `n` items from `in` through the stages to `sink`.
+    template<class In, class Sink>
+    void run( In const *in, size_t n, Sink &&sink )
+    {
+        constexpr size_t batch = BatchBytes / sizeof( In ) > 16
+                                 ? BatchBytes / sizeof( In ) : 16;
+
+        buffers<In> scratch;
+        for ( size_t at = 0; at < n; at += batch ) {
+            size_t count = n - at < batch ? n - at : batch;
+            if constexpr ( is_batch_group<0>() ) {
+                std::get<0>( scratch ).assign( in + at, in + at + count );
+                run_groups<0>( scratch, sink );
+            }
+            else {
+                // an item-wise first group reads the input in place
+                run_items<0>( in + at, in + at + count, scratch, sink );
+            }
+        }
+    }
+
+    template<class In, class Sink>
+    void run( std::vector<In> const &in, Sink &&sink )
+    {
+        run( in.data(), in.size(), std::forward<Sink>( sink ) );
+    }
+
+private:
+
+    static constexpr size_t group_count = length_v<groups>;
+
+    template<class... Gs>
+    static constexpr std::array<size_t, sizeof...( Gs ) + 1>
+    bounds_of( maybe<Gs...> )
+    {
+        std::array<size_t, sizeof...( Gs ) + 1> b{};
+        size_t lengths[] = { length_v<Gs>..., 0 };
+
+        for ( size_t g = 0; g < sizeof...( Gs ); ++g ) {
+            b[g + 1] = b[g] + lengths[g];
+        }
+        return b;
+    }
+
+    // stages of the group `G` are `[ bounds[G], bounds[G + 1] )`
+    static constexpr auto bounds = bounds_of( groups{} );
+
+    template<size_t I, size_t End, class T>
+    struct result
+    {
+        $def std::tuple_element_t<I, std::tuple<Stages...>> stage;
+
+        // filters and batches keep the type of items
+        template<class S, bool Keeps> struct step { $def T type; };
+        template<class S> struct step<S, false>
+        {
+            $def std::decay_t<std::invoke_result_t<S &, T>> type;
+        };
+
+        $type step<
+            stage, is_filter_stage<stage>::value || is_batch_stage<stage>::value
+            >::type next;
+
+        $type result<I + 1, End, next>::type type;
+    };
+
+    template<size_t End, class T>
+    struct result<End, End, T> { $def T type; };
+
+    // item types entering every group, the last one leaves the pipeline
+    template<class In, size_t... Gs>
+    static $deduce buffers_of( std::index_sequence<Gs...> )
+    -> std::tuple<std::vector<typename result<0, bounds[Gs], In>::type>...>;
+
+    template<class In>
+    using buffers =
+        decltype( buffers_of<In>( std::make_index_sequence<group_count + 1>{} ) );
+
+    template<size_t I, size_t End, class T, class Emit>
+    void push( T &&v, Emit &emit )
+    {
+        if constexpr ( I == End ) {
+            emit( std::forward<T>( v ) );
+        }
+        else {
+            auto &s = std::get<I>( stages_ );
+
+            if constexpr ( is_filter_stage<std::decay_t<decltype( s )>>::value ) {
+                if ( s( std::as_const( v ) ) ) {
+                    push<I + 1, End>( std::forward<T>( v ), emit );
+                }
+            }
+            else {
+                push<I + 1, End>( s( std::forward<T>( v ) ), emit );
+            }
+        }
+    }
+
+    template<size_t G>
+    static constexpr bool is_batch_group()
+    {
+        return is_batch_stage<
+            std::tuple_element_t<bounds[G], std::tuple<Stages...>>>::value;
+    }
+
+    // items `[first, last)` through the item-wise group `G`
+    template<size_t G, class It, class Buffers, class Sink>
+    void run_items( It first, It last, Buffers &scratch, Sink &sink )
+    {
+        constexpr size_t begin = bounds[G];
+        constexpr size_t end   = bounds[G + 1];
+
+        if constexpr ( G + 1 == group_count ) {
+            // the last group feeds the sink directly
+            for ( ; first != last; ++first ) {
+                push<begin, end>( *first, sink );
+            }
+        }
+        else {
+            auto &out  = std::get<G + 1>( scratch );
+            auto store = [&out]( auto &&v ) {
+                out.push_back( std::forward<decltype( v )>( v ) );
+            };
+
+            out.clear();
+            for ( ; first != last; ++first ) {
+                push<begin, end>( *first, store );
+            }
+            run_groups<G + 1>( scratch, sink );
+        }
+    }
+
+    template<size_t G, class Buffers, class Sink>
+    void run_groups( Buffers &scratch, Sink &sink )
+    {
+        auto &in = std::get<G>( scratch );
+
+        if constexpr ( G == group_count ) {
+            for ( auto &v : in ) {
+                sink( std::move( v ) );
+            }
+        }
+        else if constexpr ( is_batch_group<G>() ) {
+            std::get<bounds[G]>( stages_ )( in );
+            std::get<G + 1>( scratch ).swap( in );
+            run_groups<G + 1>( scratch, sink );
+        }
+        else {
+            run_items<G>( std::make_move_iterator( in.begin() ),
+                          std::make_move_iterator( in.end() ), scratch, sink );
+        }
+    }
+
+    std::tuple<Stages...> stages_;
+};
+
+/// \brief   pipeline without stages, every item goes to the sink.
+template<size_t BatchBytes>
+class pipeline<list<>, BatchBytes>
+{
+public:
+
+    $def maybe<> groups;
+    $def list<> batch_stages;
+
+    template<class In, class Sink>
+    void run( In const *in, size_t n, Sink &&sink )
+    {
+        for ( size_t i = 0; i < n; ++i ) {
+            sink( in[i] );
+        }
+    }
+
+    template<class In, class Sink>
+    void run( std::vector<In> const &in, Sink &&sink )
+    {
+        run( in.data(), in.size(), std::forward<Sink>( sink ) );
+    }
+};
+} // mind
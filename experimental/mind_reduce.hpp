@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   mind_reduce.hpp
+/// \brief  sum, min and max of integers, example of a dispatched kernel
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "mind_dispatch.hpp"
+
+#if MIND_X86
+#include <immintrin.h>
+#endif
+
+namespace mind
+{
+////////////////////////////////////////////////////////////////////////////////
+//
+//  REDUCE
+
+struct reduce_result
+{
+    int64_t sum = 0;
+    int32_t min = std::numeric_limits<int32_t>::max();
+    int32_t max = std::numeric_limits<int32_t>::min();
+};
+
+namespace impl
+{
+inline reduce_result reduce_tail( reduce_result r, int32_t const *p, size_t n )
+{
+    for ( size_t i = 0; i < n; ++i ) {
+        r.sum += p[i];
+        r.min  = p[i] < r.min ? p[i] : r.min;
+        r.max  = p[i] > r.max ? p[i] : r.max;
+    }
+    return r;
+}
+} // impl
+
+template<class Isa> struct reduce_kernel;
+
+template<> struct reduce_kernel<isa::scalar>
+{
+    static reduce_result run( int32_t const *p, size_t n )
+    {
+        return impl::reduce_tail( {}, p, n );
+    }
+};
+
+#if MIND_X86
+
+template<> struct reduce_kernel<isa::sse42>
+{
+    MIND_TARGET( "sse4.2" )
+    static reduce_result run( int32_t const *p, size_t n )
+    {
+        __m128i sum = _mm_setzero_si128();
+        __m128i lo  = _mm_set1_epi32( std::numeric_limits<int32_t>::max() );
+        __m128i hi  = _mm_set1_epi32( std::numeric_limits<int32_t>::min() );
+
+        size_t i = 0;
+        for ( ; i + 4 <= n; i += 4 ) {
+            __m128i v = _mm_loadu_si128( reinterpret_cast<__m128i const *>( p + i ) );
+            sum = _mm_add_epi64( sum, _mm_cvtepi32_epi64( v ) );
+            sum = _mm_add_epi64( sum, _mm_cvtepi32_epi64( _mm_srli_si128( v, 8 ) ) );
+            lo  = _mm_min_epi32( lo, v );
+            hi  = _mm_max_epi32( hi, v );
+        }
+
+        alignas( 16 ) int64_t sums[2];
+        alignas( 16 ) int32_t mins[4], maxs[4];
+        _mm_store_si128( reinterpret_cast<__m128i *>( sums ), sum );
+        _mm_store_si128( reinterpret_cast<__m128i *>( mins ), lo );
+        _mm_store_si128( reinterpret_cast<__m128i *>( maxs ), hi );
+
+        reduce_result r;
+        r.sum = sums[0] + sums[1];
+        for ( int k = 0; k < 4; ++k ) {
+            r.min = mins[k] < r.min ? mins[k] : r.min;
+            r.max = maxs[k] > r.max ? maxs[k] : r.max;
+        }
+        return impl::reduce_tail( r, p + i, n - i );
+    }
+};
+
+template<> struct reduce_kernel<isa::avx2>
+{
+    MIND_TARGET( "avx2" )
+    static reduce_result run( int32_t const *p, size_t n )
+    {
+        __m256i sum = _mm256_setzero_si256();
+        __m256i lo  = _mm256_set1_epi32( std::numeric_limits<int32_t>::max() );
+        __m256i hi  = _mm256_set1_epi32( std::numeric_limits<int32_t>::min() );
+
+        size_t i = 0;
+        for ( ; i + 8 <= n; i += 8 ) {
+            __m256i v = _mm256_loadu_si256( reinterpret_cast<__m256i const *>( p + i ) );
+            sum = _mm256_add_epi64( sum, _mm256_cvtepi32_epi64( _mm256_castsi256_si128( v ) ) );
+            sum = _mm256_add_epi64( sum, _mm256_cvtepi32_epi64( _mm256_extracti128_si256( v, 1 ) ) );
+            lo  = _mm256_min_epi32( lo, v );
+            hi  = _mm256_max_epi32( hi, v );
+        }
+
+        alignas( 32 ) int64_t sums[4];
+        alignas( 32 ) int32_t mins[8], maxs[8];
+        _mm256_store_si256( reinterpret_cast<__m256i *>( sums ), sum );
+        _mm256_store_si256( reinterpret_cast<__m256i *>( mins ), lo );
+        _mm256_store_si256( reinterpret_cast<__m256i *>( maxs ), hi );
+
+        reduce_result r;
+        r.sum = sums[0] + sums[1] + sums[2] + sums[3];
+        for ( int k = 0; k < 8; ++k ) {
+            r.min = mins[k] < r.min ? mins[k] : r.min;
+            r.max = maxs[k] > r.max ? maxs[k] : r.max;
+        }
+        return impl::reduce_tail( r, p + i, n - i );
+    }
+};
+
+#endif // if MIND_X86
+
+/// \brief   `reduce_kernel` of the best backend of the host.
+$def dispatch<reduce_kernel, list<isa::avx2, isa::sse42, isa::scalar>> reduce;
+} // mind
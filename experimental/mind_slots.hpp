@@ -0,0 +1,165 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   mind_slots.hpp
+/// \brief  objects owned per thread and recycled when the thread exits
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace mind
+{
+////////////////////////////////////////////////////////////////////////////////
+//
+//  THREAD_SLOTS
+
+/*!
+\class   `thread_slots<T>`
+\brief   a `T` for every thread which uses it, handed back when it exits.
+
+\details `local` finds the slot of the calling thread in a `thread_local`
+         list, the first call of a thread takes a free slot or makes one.
+         At thread exit its slots go to the free lists of their owners, so
+         there are as many slots as threads ever ran at once. A slot keeps
+         its contents, the next thread goes on from them. Entries of owners
+         which are gone are dropped on the next miss of the thread.
+         Usage: `thread_slots<shard> shards;`
+                `shards.local( [] { return std::make_unique<shard>(); } )`
+*/
+template<class T>
+class thread_slots
+{
+    struct registry
+    {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<T>> slots;
+        std::vector<T *> free;
+    };
+
+    // owners are told apart by a serial number, an address may be reused
+    struct entry
+    {
+        uint64_t serial;
+        T *slot;
+        std::weak_ptr<registry> owner;
+    };
+
+    struct cache
+    {
+        std::vector<entry> entries;
+
+        ~cache()
+        {
+            for ( auto &e : entries ) {
+                if ( auto r = e.owner.lock() ) {
+                    std::lock_guard<std::mutex> lock( r->mutex );
+                    r->free.push_back( e.slot );
+                }
+            }
+        }
+    };
+
+public:
+
+    thread_slots() = default;
+
+    thread_slots( thread_slots const & )            = delete;
+    thread_slots& operator=( thread_slots const & ) = delete;
+
+    /// \brief   slot of the calling thread, `make()` returns a new
+    ///          `std::unique_ptr<T>` if there is no free one.
+    template<class Make>
+    T& local( Make &&make )
+    {
+        auto &c = local_cache();
+        for ( auto &e : c.entries ) {
+            if ( e.serial == serial_ ) {
+                return *e.slot;
+            }
+        }
+        return acquire( c, make );
+    }
+
+    /// \brief   every slot, in use or free.
+    std::vector<T *> all() const
+    {
+        std::lock_guard<std::mutex> lock( registry_->mutex );
+
+        std::vector<T *> slots;
+        for ( auto &s : registry_->slots ) {
+            slots.push_back( s.get() );
+        }
+        return slots;
+    }
+
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock( registry_->mutex );
+        return registry_->slots.size();
+    }
+
+private:
+
+    static cache& local_cache()
+    {
+        thread_local cache c;
+        return c;
+    }
+
+    template<class Make>
+    T& acquire( cache &c, Make &make )
+    {
+        auto &entries = c.entries;
+        for ( size_t i = entries.size(); i-- > 0; ) {
+            if ( entries[i].owner.expired() ) {
+                entries.erase( entries.begin() + i );
+            }
+        }
+
+        T *slot = nullptr;
+        {
+            std::lock_guard<std::mutex> lock( registry_->mutex );
+            if ( !registry_->free.empty() ) {
+                slot = registry_->free.back();
+                registry_->free.pop_back();
+            }
+            else {
+                registry_->slots.push_back( make() );
+                slot = registry_->slots.back().get();
+            }
+        }
+        entries.push_back( { serial_, slot, registry_ } );
+        return *slot;
+    }
+
+    static uint64_t next_serial()
+    {
+        static std::atomic<uint64_t> serial{ 0 };
+        return serial.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    uint64_t serial_ = next_serial();
+    std::shared_ptr<registry> registry_ = std::make_shared<registry>();
+};
+} // mind
@@ -16,10 +16,12 @@
 /// \author Grisha Kirilin
 /// \date   6/5/2018
 
+#pragma once
 
 ////////////////////////////////////////////////////////////////////////////////
 // Includes:
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
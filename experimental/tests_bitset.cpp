@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   tests_bitset.cpp
+/// \brief  Test runtime sets of types `type_bitset`
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include "mind_bitset.hpp"
+#include "tests/utest_surrogate.hpp"
+
+#include <utility>
+
+////////////////////////////////////////////////////////////////////////////////
+// Test helpers
+
+template<class... T> struct foo {};
+template<size_t I> struct cap {};
+
+template<size_t... Is>
+auto caps( std::index_sequence<Is...> ) -> mind::list<cap<Is>...>;
+
+////////////////////////////////////////////////////////////////////////////////
+// Entry point
+
+int main()
+{
+    using namespace mind;
+
+    typedef type_bitset<foo<int, float, double, char>> small;
+    typedef type_bitset<decltype( caps( std::make_index_sequence<100>{} ) )> large;
+
+    constexpr auto ifd = small::of<foo<int, float, double>>();
+    constexpr auto d   = small::of<foo<double>>();
+    constexpr auto fd  = small::of<list<float, double>>();
+
+    static_assert( ifd.word( 0 ) == 0b0111 && d.word( 0 ) == 0b0100 );
+
+    large many;
+    many.insert<cap<3>>().insert<cap<70>>().insert<cap<99>>();
+    auto tail = large::of<list<cap<70>, cap<99>>>();
+
+    unit_test( std::cout )
+
+    .section(
+        "Test bits of `type_bitset`",
+        small::bit<int>() == 0 && small::bit<char>() == 3,
+        large::words == 2,
+        small{}.empty() && small{}.count() == 0,
+        ifd.count() == 3 && ifd.contains<float>() && !ifd.contains<char>() )
+
+    .section(
+        "Test `is_subset_of` against `is_subset_v`",
+        d.is_subset_of( ifd ) == is_subset_v<foo<double>, foo<int, float, double>>,
+        ifd.is_subset_of( d ) == is_subset_v<foo<int, float, double>, foo<double>>,
+        tail.is_subset_of( many ) && !many.is_subset_of( tail ) )
+
+    .section(
+        "Test `complement` against `complement_t`",
+        ifd.complement( d )
+        == small::of<complement_t<foo<int, float, double>, foo<double>>>(),
+        many.complement( tail ) == large{}.insert<cap<3>>() )
+
+    .section(
+        "Test union and intersection",
+        ( d | small::of<foo<int, float>>() ) == ifd,
+        ( ifd & fd ) == fd,
+        small::of<union_set_t<foo<int>, foo<float, double>>>() == ifd,
+        ( many & tail ).count() == 2 )
+
+    .flush_stat();
+
+    return 0;
+}
+
+WUBBA_LUBBA_DUB_DUB
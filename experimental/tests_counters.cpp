@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+/// \file   tests_counters.cpp
+/// \brief  Test sharded counters per type `type_counters`
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include "mind_counters.hpp"
+#include "tests/utest_surrogate.hpp"
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// Test helpers
+
+struct order {};
+struct cancel {};
+struct quote {};
+
+typedef mind::type_counters<mind::list<order, cancel, quote>> message_counters;
+
+////////////////////////////////////////////////////////////////////////////////
+// Entry point
+
+int main()
+{
+    using namespace mind;
+
+    message_counters single;
+    single.add<order>();
+    single.add<order>();
+    single.add<quote>( 5 );
+
+    message_counters other;
+    other.add<cancel>();
+
+    message_counters threaded;
+    std::vector<std::thread> threads;
+    for ( int t = 0; t < 4; ++t ) {
+        threads.emplace_back( [&threaded] {
+            for ( int i = 0; i < 10000; ++i ) {
+                threaded.add<order>();
+                threaded.add<cancel>( 2 );
+            }
+        } );
+    }
+    for ( auto &t : threads ) {
+        t.join();
+    }
+
+    // threads come and go, their shards are reused
+    message_counters churn;
+    for ( int t = 0; t < 32; ++t ) {
+        std::thread( [&churn] { churn.add<quote>(); } ).join();
+    }
+
+    std::ostringstream text;
+    single.expose( text, "messages_total" );
+
+    unit_test( std::cout )
+
+    .section(
+        "Test layout of shards",
+        alignof( message_counters::shard ) == 64,
+        sizeof( message_counters::shard ) % 64 == 0 )
+
+    .section(
+        "Test counts of one thread",
+        single.count<order>() == 2,
+        single.count<cancel>() == 0,
+        single.count<quote>() == 5,
+        other.count<order>() == 0 && other.count<cancel>() == 1 )
+
+    .section(
+        "Test counts of threads which are gone",
+        threaded.count<order>() == 40000,
+        threaded.count<cancel>() == 80000,
+        threaded.snapshot()[2] == 0 )
+
+    .section(
+        "Test shards of threads which come and go",
+        churn.count<quote>() == 32,
+        churn.shards() == 1,
+        threaded.shards() <= 4 )
+
+    .section(
+        "Test text exposition",
+        text.str() == "# TYPE messages_total counter\n"
+                      "messages_total{type=\"order\"} 2\n"
+                      "messages_total{type=\"cancel\"} 0\n"
+                      "messages_total{type=\"quote\"} 5\n" )
+
+    .flush_stat();
+
+    return 0;
+}
+
+WUBBA_LUBBA_DUB_DUB
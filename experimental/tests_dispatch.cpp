@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   tests_dispatch.cpp
+/// \brief  Test kernel dispatch among instruction set backends
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include "mind_reduce.hpp"
+#include "tests/utest_surrogate.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Test helpers
+
+struct unbuildable
+{
+    enum { buildable = false };
+    static bool supported() { return true; }
+};
+
+template<class Isa>
+bool same_as_scalar( std::vector<int32_t> const &v )
+{
+    if ( !Isa::supported() ) {
+        return true;
+    }
+
+    auto expect = mind::reduce_kernel<mind::isa::scalar>::run( v.data(), v.size() );
+    auto actual = mind::reduce_kernel<Isa>::run( v.data(), v.size() );
+
+    return expect.sum == actual.sum && expect.min == actual.min
+           && expect.max == actual.max;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Entry point
+
+int main()
+{
+    using namespace mind;
+    using std::is_same_v;
+
+    std::vector<int32_t> values( 1003 );
+    for ( size_t i = 0; i < values.size(); ++i ) {
+        values[i] = int32_t( i * 2654435761u );
+    }
+
+    auto r = reduce::run( values.data(), values.size() );
+    auto e = reduce_kernel<isa::scalar>::run( values.data(), values.size() );
+
+    std::cout << "active backend: " << reduce::active() << "\n\n";
+
+    unit_test( std::cout )
+
+    .section(
+        "Test backend filter `select_t<is_buildable, ...>`",
+        is_same_v<list<isa::scalar>,
+                  select_t<is_buildable, list<unbuildable, isa::scalar>>> )
+
+    .section(
+        "Test backends of `reduce_kernel`",
+        same_as_scalar<isa::sse42>( values ),
+        same_as_scalar<isa::avx2>( values ),
+        same_as_scalar<isa::sse42>( { -5, 7, 3 } ),
+        same_as_scalar<isa::avx2>( {} ) )
+
+    .section(
+        "Test dispatched `reduce`",
+        r.sum == e.sum && r.min == e.min && r.max == e.max,
+        reduce::run( values.data(), 0 ).sum == 0,
+        !cpu().avx2 || reduce::active() == "avx2" )
+
+    .flush_stat();
+
+    return 0;
+}
+
+WUBBA_LUBBA_DUB_DUB
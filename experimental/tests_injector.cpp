@@ -0,0 +1,152 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   tests_injector.cpp
+/// \brief  Test compile-time dependency injection
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include "mind_injector.hpp"
+#include "tests/utest_surrogate.hpp"
+
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////
+// Test classes
+
+std::string trace;
+
+struct config
+{
+    config() { trace += "c"; }
+    ~config() { trace += "~c"; }
+    int port = 8080;
+};
+
+struct storage
+{
+    virtual ~storage() {}
+    virtual int size() const = 0;
+};
+
+struct disk_storage : storage
+{
+    disk_storage( config &cfg ) : cfg_{ cfg } { trace += "d"; }
+    ~disk_storage() { trace += "~d"; }
+    int size() const override { return cfg_.port; }
+    config &cfg_;
+};
+
+struct server
+{
+    server( storage &db, config const &cfg ) : db_{ db }, cfg_{ cfg }
+    {
+        trace += "s";
+    }
+    ~server() { trace += "~s"; }
+    storage &db_;
+    config const &cfg_;
+};
+
+// one argument, listed before its dependency
+struct front
+{
+    front( config &cfg ) : cfg_{ cfg } {}
+    config &cfg_;
+};
+
+// holds a copy of the singleton, the injector rejects it
+struct copying
+{
+    copying( config cfg ) : port_{ cfg.port } {}
+    int port_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Entry point
+
+int main()
+{
+    using namespace mind;
+    using std::is_same_v;
+
+    typedef list<server, bind<storage, disk_storage>, config> app_bindings;
+
+    bool wired   = false;
+    bool ordered = false;
+    {
+        injector<app_bindings> app;
+
+        wired = &app.get<server>().db_ == &app.get<storage>()
+                && &app.get<server>().cfg_ == &app.get<config>()
+                && app.get<storage>().size() == 8080;
+        ordered = trace == "cds";
+    }
+    bool released = trace == "cds~s~d~c";
+
+    bool unordered = false;
+    {
+        injector<list<front, config>> app;
+        unordered = &app.get<front>().cfg_ == &app.get<config>();
+    }
+
+    // `x` needs `a` and `b`, which need each other
+    constexpr std::array<bool, 9> tail_cycle =
+        { false, true, true, false, false, true, false, true, false };
+    constexpr size_t culprit =
+        impl::on_cycle<3>( tail_cycle, impl::topological_order<3>( tail_cycle ) );
+
+    unit_test( std::cout )
+
+    .section(
+        "Test dependencies of constructor `impl::dependencies`",
+        is_same_v<list<>,
+                  impl::dependencies<config, list<config>, 4>::type>,
+        is_same_v<list<storage, config>,
+                  impl::dependencies<server, list<config, storage>, 4>::type>,
+        is_same_v<list<config>,
+                  impl::dependencies<front, list<front, config>, 4>::type> )
+
+    .section(
+        "Test keys taken by reference `impl::by_reference`",
+        impl::by_reference<server, list<storage, config>,
+                           std::index_sequence<0, 1>>::value,
+        impl::by_reference<disk_storage, list<config>,
+                           std::index_sequence<0>>::value,
+        !impl::by_reference<copying, list<config>,
+                            std::index_sequence<0>>::value )
+
+    .section(
+        "Test construction order `impl::topological_order`",
+        impl::topological_order<3>(
+            { false, true, true, false, false, true, false, false, false } )
+        .order == std::array<size_t, 3>{ 2, 1, 0 },
+        impl::topological_order<2>( { false, true, true, false } ).length == 0,
+        culprit == 1 || culprit == 2,
+        impl::on_cycle<2>( { false, true, false, false },
+                           impl::topological_order<2>( { false, true, false, false } ) )
+        == 2 )
+
+    .section(
+        "Test singletons of `injector`",
+        wired, ordered, released, unordered )
+
+    .flush_stat();
+
+    return 0;
+}
+
+WUBBA_LUBBA_DUB_DUB
@@ -0,0 +1,194 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   tests_logger.cpp
+/// \brief  Test structured logging with compile-time schemas
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include "mind_logger.hpp"
+#include "tests/utest_surrogate.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+////////////////////////////////////////////////////////////////////////////////
+// Test helpers
+
+enum class level : uint8_t { info = 1, warn = 2 };
+
+struct point { int16_t x, y; };
+
+// drop the time stamps, they differ between the runs
+std::string untimed( std::string const &log )
+{
+    std::istringstream in( log );
+    std::string line, result;
+
+    while ( std::getline( in, line ) ) {
+        result += line.substr( line.find( "] " ) + 2 ) + "\n";
+    }
+    return result;
+}
+
+void statements( mind::logger &log )
+{
+    MIND_LOG( log, "started" );
+    MIND_LOG( log, "user {id} took {ms} ms", 42u, 1.5 );
+    MIND_LOG( log, "level {lvl} flag {ok} at {pos}",
+              level::warn, true, point{ 1, -1 } );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Entry point
+
+int main()
+{
+    using namespace mind;
+
+    constexpr log_site site =
+        log_schema<list<int, double>>::make( "a {first} b {second}" );
+
+    std::ostringstream text;
+    {
+        logger log( text );
+        statements( log );
+    }
+
+    std::stringstream binary;
+    {
+        logger log( binary, logger::binary );
+        statements( log );
+    }
+    std::ostringstream decoded;
+    bool valid = log_decoder( binary, decoded );
+
+    // a record `'E' id time size payload` with a 4 byte payload last
+    std::stringstream one;
+    {
+        logger log( one, logger::binary );
+        MIND_LOG( log, "n {n}", int( 7 ) );
+    }
+    std::string const good = one.str();
+    std::string const zero( 4, '\0' );
+
+    // a site with one field of `kind` and `size`, and a record of it
+    auto forged = []( field_kind kind, uint32_t size ) {
+        std::string bytes = "MINDLOG1";
+        auto put = [&bytes]( auto v ) {
+            bytes.append( reinterpret_cast<char const *>( &v ), sizeof( v ) );
+        };
+        auto put_string = [&]( std::string_view s ) {
+            put( uint32_t( s.size() ) );
+            bytes.append( s );
+        };
+        put( 'S' ); put( uint32_t( 0 ) ); put_string( "n {n}" );
+        put( uint32_t( 1 ) ); put_string( "n" ); put_string( "long" );
+        put( kind ); put( size );
+        put( 'E' ); put( uint32_t( 0 ) ); put( uint64_t( 0 ) ); put( size );
+        return bytes + std::string( size, '\x7f' );
+    };
+
+    auto decodes = []( std::string const &bytes ) {
+        std::istringstream in( bytes );
+        std::ostringstream out;
+        return log_decoder( in, out );
+    };
+
+    std::ostringstream threaded;
+    size_t dropped = 0;
+    {
+        logger log( threaded, logger::text, 1 << 20 );
+        std::vector<std::thread> threads;
+        for ( int t = 0; t < 4; ++t ) {
+            threads.emplace_back( [&log, t] {
+                for ( int i = 0; i < 1000; ++i ) {
+                    MIND_LOG( log, "thread {t} item {i}", t, i );
+                }
+            } );
+        }
+        for ( auto &thread : threads ) {
+            thread.join();
+        }
+        log.flush();
+        dropped = log.dropped();
+    }
+    // threads come and go, their rings are reused
+    std::ostringstream churned;
+    size_t rings = 0;
+    {
+        logger log( churned );
+        for ( int t = 0; t < 32; ++t ) {
+            std::thread( [&log, t] { MIND_LOG( log, "thread {t}", t ); } ).join();
+        }
+        rings = log.rings();
+    }
+    std::string const churn = churned.str();
+
+    std::string const all = threaded.str();
+    size_t lines = std::count( all.begin(), all.end(), '\n' );
+
+    std::string const expected =
+        "started\n"
+        "user 42 took 1.5 ms\n"
+        "level 2 flag true at 0x0100ffff\n";
+
+    unit_test( std::cout )
+
+    .section(
+        "Test compile-time `log_site`",
+        site.fields == 2 && site.size == sizeof( int ) + sizeof( double ),
+        site.names[0] == "first" && site.names[1] == "second",
+        site.types[0] == "int" && site.types[1] == "double",
+        site.kinds[0] == field_kind::i32 && site.kinds[1] == field_kind::f64 )
+
+    .section(
+        "Test text `logger`",
+        untimed( text.str() ) == expected )
+
+    .section(
+        "Test binary `logger` and `log_decoder`",
+        valid,
+        untimed( decoded.str() ) == expected )
+
+    .section(
+        "Test `log_decoder` on broken logs",
+        decodes( good ),
+        !decodes( good.substr( 0, good.size() - 2 ) ),
+        !decodes( good.substr( 0, good.size() - 8 ) + zero ),
+        !decodes( "MINDLOG0" ),
+        decodes( forged( field_kind::u64, 8 ) ),
+        decodes( forged( field_kind::bytes, 3 ) ),
+        !decodes( forged( field_kind::u64, 1 ) ),
+        !decodes( forged( field_kind::u64, 0 ) ),
+        !decodes( forged( field_kind::bytes, 0 ) ),
+        !decodes( forged( field_kind( 13 ), 8 ) ) )
+
+    .section(
+        "Test `logger` with many threads",
+        dropped == 0 && lines == 4000 )
+
+    .section(
+        "Test `logger` with threads which come and go",
+        rings == 1,
+        std::count( churn.begin(), churn.end(), '\n' ) == 32 )
+
+    .flush_stat();
+
+    return 0;
+}
+
+WUBBA_LUBBA_DUB_DUB
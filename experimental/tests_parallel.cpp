@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   tests_parallel.cpp
+/// \brief  Test partition of type lists and parallel visit of tuples
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include "mind_parallel.hpp"
+#include "tests/utest_surrogate.hpp"
+
+#include <stdexcept>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////
+// Test helpers
+
+template<class... T> struct foo {};
+
+template<class T> struct size_cost { enum : size_t { value = sizeof( T ) }; };
+
+struct twice
+{
+    void operator()( int &v ) const { v *= 2; }
+    void operator()( double &v ) const { v *= 2; }
+    void operator()( std::string &v ) const { v += v; }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Entry point
+
+int main()
+{
+    using namespace mind;
+    using std::is_same_v;
+
+    std::tuple<int, double, std::string, int, double> values{
+        1, 1.5, "ab", 3, 0.25
+    };
+    auto copy = values;
+
+    bool visited = false;
+    {
+        thread_pool pool( 3 );
+        parallel_for_each( values, twice{}, pool );
+        parallel_for_each<2>( copy, twice{}, pool );
+        visited = values == std::make_tuple( 2, 3.0, std::string( "abab" ), 6, 0.5 )
+                  && values == copy;
+    }
+
+    bool serial = false;
+    {
+        thread_pool pool( 0 );
+        parallel_for_each<4>( values, twice{}, pool );
+        serial = std::get<0>( values ) == 4 && std::get<2>( values ) == "abababab";
+    }
+
+    bool rethrown = false;
+    try {
+        thread_pool pool( 2 );
+        std::tuple<int, int> pair{ 0, 1 };
+        parallel_for_each( pair, []( int v ) {
+            if ( v ) {
+                throw std::runtime_error( "odd" );
+            }
+        }, pool );
+    }
+    catch ( std::runtime_error const & ) {
+        rethrown = true;
+    }
+
+    unit_test( std::cout )
+
+    .section(
+        "Test meta function `chunk_t`",
+        is_same_v<maybe<foo<>>, chunk_t<1, foo<>>>,
+        is_same_v<maybe<foo<int, char>>, chunk_t<1, foo<int, char>>>,
+        is_same_v<maybe<foo<int>, foo<>, foo<char>>, chunk_t<3, foo<int, char>>>,
+        is_same_v<maybe<foo<int, int, int>, foo<char, char, char, char>, foo<long, long, long>>,
+                  chunk_t<3, foo<int, int, int, char, char, char, char, long, long, long>>> )
+
+    .section(
+        "Test meta function `partition_t`",
+        is_same_v<maybe<foo<double>, foo<char, char, char, char, char, char, char, char>>,
+                  partition_t<size_cost, 2,
+                              foo<double, char, char, char, char, char, char, char, char>>>,
+        is_same_v<maybe<foo<char, char, char, char>, foo<int>>,
+                  partition_t<size_cost, 2, foo<char, char, char, char, int>>> )
+
+    .section(
+        "Test `parallel_for_each` on `thread_pool`",
+        visited, serial, rethrown )
+
+    .flush_stat();
+
+    return 0;
+}
+
+WUBBA_LUBBA_DUB_DUB
@@ -0,0 +1,133 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+/// \file   tests_pipeline.cpp
+/// \brief  Test fused stream processing pipelines
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include "mind_pipeline.hpp"
+#include "tests/utest_surrogate.hpp"
+
+#include <algorithm>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////
+// Test stages
+
+struct half : mind::map_stage
+{
+    double operator()( int v ) const { return v / 2.0; }
+};
+
+struct is_whole : mind::filter_stage
+{
+    bool operator()( double v ) const { return v == int( v ); }
+};
+
+struct numbered : mind::stateful_stage
+{
+    std::string operator()( double v )
+    {
+        return std::to_string( count++ ) + ":" + std::to_string( int( v ) );
+    }
+    int count = 0;
+};
+
+struct descending : mind::batch_stage
+{
+    void operator()( std::vector<double> &batch ) const
+    {
+        std::sort( batch.rbegin(), batch.rend() );
+    }
+};
+
+struct not_a_stage {};
+
+////////////////////////////////////////////////////////////////////////////////
+// Entry point
+
+int main()
+{
+    using namespace mind;
+    using std::is_same_v;
+
+    std::vector<int> input{ 1, 2, 3, 4, 5, 6, 7, 8 };
+
+    std::vector<std::string> fused;
+    pipeline<list<half, is_whole, numbered>> straight;
+    straight.run( input, [&]( std::string s ) { fused.push_back( s ); } );
+
+    std::vector<std::string> sorted;
+    pipeline<list<half, is_whole, descending, numbered>> reordered;
+    reordered.run( input, [&]( std::string s ) { sorted.push_back( s ); } );
+
+    std::vector<double> tail;
+    pipeline<list<half, descending>> sorted_last;
+    sorted_last.run( input, [&]( double v ) { tail.push_back( v ); } );
+
+    std::vector<double> halves{ 0.5, 2.5, 1.5 }, only;
+    pipeline<list<descending>> batch_only;
+    batch_only.run( halves, [&]( double v ) { only.push_back( v ); } );
+
+    std::vector<int> copied;
+    pipeline<list<>> empty;
+    empty.run( input, [&]( int v ) { copied.push_back( v ); } );
+
+    // batches of 16 items, the state survives between them
+    std::vector<int> many( 40, 2 );
+    size_t count = 0;
+    pipeline<list<half, numbered>, 16 * sizeof( int )> batched;
+    batched.run( many, [&]( std::string const & ) { ++count; } );
+
+    unit_test( std::cout )
+
+    .section(
+        "Test stage kinds",
+        is_map_stage<half>::value && is_fusable_stage<half>::value,
+        is_filter_stage<is_whole>::value && is_fusable_stage<is_whole>::value,
+        is_stateful_stage<numbered>::value && is_fusable_stage<numbered>::value,
+        is_batch_stage<descending>::value && !is_fusable_stage<descending>::value,
+        !is_stage<not_a_stage>::value )
+
+    .section(
+        "Test meta function `fuse_t`",
+        is_same_v<maybe<>, fuse_t<list<>>>,
+        is_same_v<maybe<list<half, is_whole, numbered>>,
+                  fuse_t<list<half, is_whole, numbered>>>,
+        is_same_v<maybe<list<half, is_whole>, list<descending>, list<numbered>>,
+                  fuse_t<list<half, is_whole, descending, numbered>>>,
+        is_same_v<maybe<list<descending>, list<descending>>,
+                  fuse_t<list<descending, descending>>> )
+
+    .section(
+        "Test `pipeline::run`",
+        fused == std::vector<std::string>{ "0:1", "1:2", "2:3", "3:4" },
+        sorted == std::vector<std::string>{ "0:4", "1:3", "2:2", "3:1" },
+        count == 40 && batched.stage<numbered>().count == 40 )
+
+    .section(
+        "Test `pipeline::run` with a batch stage last, alone and no stages",
+        tail == std::vector<double>{ 4, 3.5, 3, 2.5, 2, 1.5, 1, 0.5 },
+        only == std::vector<double>{ 2.5, 1.5, 0.5 },
+        copied == input )
+
+    .flush_stat();
+
+    return 0;
+}
+
+WUBBA_LUBBA_DUB_DUB
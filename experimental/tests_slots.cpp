@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2018 Grisha Kirilin
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+/// \file   tests_slots.cpp
+/// \brief  Test objects owned per thread `thread_slots`
+/// \author Grisha Kirilin
+/// \date   19/10/2026
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes:
+
+#include "mind_defs.hpp"
+#include "mind_slots.hpp"
+#include "tests/utest_surrogate.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// Entry point
+
+int main()
+{
+    using namespace mind;
+
+    auto make = [] { return std::make_unique<int>( 0 ); };
+
+    // threads one after another share a slot and go on from its value
+    thread_slots<int> churn;
+    for ( int t = 0; t < 20; ++t ) {
+        std::thread( [&] { ++churn.local( make ); } ).join();
+    }
+    int const total = *churn.all().front();
+
+    // threads alive at once get a slot each, the same one on every call
+    thread_slots<int> parallel;
+    std::atomic<int> arrived{ 0 };
+    std::atomic<bool> stable{ true };
+    std::vector<std::thread> threads;
+    for ( int t = 0; t < 4; ++t ) {
+        threads.emplace_back( [&] {
+            int *first = &parallel.local( make );
+            ++arrived;
+            while ( arrived.load() < 4 ) {
+                std::this_thread::yield();
+            }
+            if ( &parallel.local( make ) != first ) {
+                stable = false;
+            }
+        } );
+    }
+    for ( auto &t : threads ) {
+        t.join();
+    }
+
+    // a thread outlives an owner, then uses a new one
+    bool outlived = false;
+    {
+        std::atomic<int> step{ 0 };
+        auto *first = new thread_slots<int>;
+        thread_slots<int> second;
+
+        std::thread user( [&] {
+            first->local( make ) = 1;
+            step = 1;
+            while ( step.load() < 2 ) {
+                std::this_thread::yield();
+            }
+            outlived = ++second.local( make ) == 1;
+        } );
+        while ( step.load() < 1 ) {
+            std::this_thread::yield();
+        }
+        delete first;
+        step = 2;
+        user.join();
+    }
+
+    unit_test( std::cout )
+
+    .section(
+        "Test recycling of `thread_slots`",
+        churn.size() == 1 && total == 20 )
+
+    .section(
+        "Test slots of threads alive at once",
+        parallel.size() == 4 && stable.load() )
+
+    .section(
+        "Test a thread which outlives the owner",
+        outlived )
+
+    .flush_stat();
+
+    return 0;
+}
+
+WUBBA_LUBBA_DUB_DUB
@@ -16,10 +16,14 @@
 /// \author Grisha Kirilin
 /// \date   8/4/2018
 
+#pragma once
+
 ////////////////////////////////////////////////////////////////////////////////
 // Includes:
 
 #include "mind_defs.hpp"
+#include <cstddef>
+#include <type_traits>
 #include <utility>
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -50,16 +54,63 @@ using apply = decltype( impl::apply<NewHead>( std::declval<TList>() ) );
 
 namespace impl
 {
+template<class TList> struct joiner { typedef TList type; };
+
 template<$class Head, class... T0, class... T1>
-$deduce join( Head<T0...>, Head<T1...> ) -> Head<T0..., T1...>;
+$deduce operator+( joiner<Head<T0...>>, joiner<Head<T1...>> )
+-> joiner<Head<T0..., T1...>>;
+
+template<class L0, class L1>
+using sum = typename decltype( joiner<L0>{} + joiner<L1>{} )::type;
+
+// a binary counter of joined runs: the fold pushes every list as a run of
+// level 0 and two runs of the same level on top merge into the next one,
+// so a list is copied once per level and there are `log2` of them
+template<size_t Level, class TList> struct run { typedef TList type; };
+
+template<class... Runs> struct runs {};
+
+template<class Runs, class Run> struct push;
+
+template<class... Rs, size_t K, class L>
+struct push<runs<Rs...>, run<K, L>> { typedef runs<run<K, L>, Rs...> type; };
+
+template<class... Rs, size_t K, class L0, class L1>
+struct push<runs<run<K, L0>, Rs...>, run<K, L1>>
+{
+    $type push<runs<Rs...>, run<K + 1, sum<L0, L1>>>::type type;
+};
+
+template<class... Rs, class L>
+$deduce operator+( runs<Rs...>, joiner<L> )
+-> typename push<runs<Rs...>, run<0, L>>::type;
+
+// runs are stacked newest first, so the rest is joined back to front
+template<$class Head, class... T0, class... T1>
+$deduce operator-( joiner<Head<T0...>>, joiner<Head<T1...>> )
+-> joiner<Head<T1..., T0...>>;
+
+template<class... Rs>
+$deduce total( runs<Rs...> )
+-> typename decltype( ( joiner<typename Rs::type>{} - ... ) )::type;
+
+template<class... TLists>
+struct join
+{
+    $def decltype( total( ( runs<>{} + ... + joiner<TLists>{} ) ) ) type;
+};
+
+template<class TList> struct join<TList> { typedef TList type; };
+
+template<> struct join<> { typedef list<> type; };
 }
 
-template<class TList0, class TList1>
-using join_t =
-    decltype( impl::join( std::declval<TList0>(), std::declval<TList1>() ) );
+/// \brief   concatenation of lists with the same head, `list<>` if none.
+template<class... TLists>
+using join_t = typename impl::join<TLists...>::type;
 
-template<class TList0, class TList1>
-struct join { $def join_t<TList0, TList1> type; };
+template<class... TLists>
+struct join { $def join_t<TLists...> type; };
 
 ////////////////////////////////////////////////////////////////////////////////
 //
@@ -160,6 +211,70 @@ struct if_else<false, Then, Else>
 template<bool Test, class Then, class Else>
 using if_else_t = typename if_else<Test, Then, Else>::type;
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  TRANSFORM
+
+namespace impl
+{
+template<$class F, $class Head, class... Ts>
+$deduce transform( Head<Ts...> ) -> Head<typename F<Ts>::type...>;
+}
+
+/// \brief   `Head<typename F<Ts>::type...>` for `TList` of `Head<Ts...>`.
+template<$class F, class TList>
+using transform_t = decltype( impl::transform<F>( std::declval<TList>() ) );
+
+template<$class F, class TList>
+struct transform { $def transform_t<F, TList> type; };
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//  FLATTEN
+
+namespace impl
+{
+template<$class, $class> struct same_head { enum { value = false }; };
+template<$class Head> struct same_head<Head, Head> { enum { value = true }; };
+
+// elements of a nested list as a plain `list`
+template<$class Head, class T>
+struct atoms { typedef list<T> type; };
+
+template<$class Head, class... Ts>
+struct spliced
+{
+    typedef join_t<list<>, typename atoms<Head, Ts>::type...> type;
+};
+
+template<$class Head, $class Inner, class... Ts>
+struct atoms<Head, Inner<Ts...>>
+{
+    $type if_else<
+        same_head<Inner, Head>::value || same_head<Inner, list>::value
+        || same_head<Inner, maybe>::value,
+        spliced<Head, Ts...>,
+        mind::append<list<>, Inner<Ts...>>
+        >::type::type type;
+};
+
+template<$class Head, class... Ts>
+$deduce flatten( Head<Ts...> )
+-> mind::apply<Head, typename atoms<Head, Head<Ts...>>::type>;
+}
+
+/// \brief   `TList` with the elements of nested `list`, `maybe` and lists
+///          of the same head spliced in place, at any depth.
+///
+/// \details The depth of instantiations grows with the depth of nesting,
+///          not with the number of elements.
+///          Usage: `flatten_t<maybe<list<int, float>, list<int>>>` is
+///          `maybe<int, float, int>`.
+template<class TList>
+using flatten_t = decltype( impl::flatten( std::declval<TList>() ) );
+
+template<class TList> struct flatten { $def flatten_t<TList> type; };
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  SELECT
@@ -330,6 +445,43 @@ struct length
 template<class TList>
 constexpr size_t length_v = length<TList>::value;
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  INDEX_OF
+
+namespace impl
+{
+template<class T, class... Ts>
+constexpr size_t index_of()
+{
+    constexpr bool found[] = { std::is_same_v<T, Ts>..., true };
+
+    size_t i = 0;
+    while ( !found[i] ) {
+        ++i;
+    }
+    return i;
+}
+
+template<class T>
+struct index_in
+{
+    template<class... Ts> struct lambda
+    {
+        enum : size_t { value = index_of<T, Ts...>() };
+    };
+};
+} // impl
+
+/// \brief   position of the first occurrence of `T` in `TList`,
+///          or `length_v<TList>` if `T` is not a member.
+template<class T, class TList>
+constexpr size_t index_of_v =
+    mind::apply<impl::index_in<T>::$lambda, TList>::value;
+
+template<class T, class TList>
+struct index_of { enum : size_t { value = index_of_v<T, TList> }; };
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 //  UNIQUE
@@ -374,5 +526,146 @@ struct union_set
 template<class TList0, class TList1>
 using union_set_t = typename union_set<TList0, TList1>::type;
 
+////////////////////////////////////////////////////////////////////////////////
+//
+//  SORT
+//
+//  A sort key is a meta-function `Key<T>` with a `constexpr` field `value`,
+//  types are ordered by `<` on their keys.
+
+template<class T> struct by_size      { enum : size_t { value = sizeof( T ) }; };
+template<class T> struct by_alignment { enum : size_t { value = alignof( T ) }; };
+template<class T> struct by_value     { static constexpr auto value = T::value; };
+
+namespace impl
+{
+template<size_t N> struct order { size_t at[N + 1]; }; // `+ 1` keeps `N = 0`
+
+template<$class Key, class... Ts>
+struct keys_of
+{
+    // common arithmetic type by a fold, `std::common_type` would recurse
+    $def decltype( ( +Key<Ts>::value + ... ) ) key_type;
+    static constexpr key_type values[] = { key_type( Key<Ts>::value )... };
+};
+
+template<$class Key> struct keys_of<Key> { static constexpr int values[1] = {}; };
+
+// bottom-up merge sort of positions, runs of `width` are already sorted
+template<size_t N, class K>
+constexpr order<N> stable_order( K const *keys, size_t width )
+{
+    order<N> from{}, to{};
+    for ( size_t i = 0; i < N; ++i ) {
+        from.at[i] = i;
+    }
+
+    for ( width = width ? width : 1; width < N; width *= 2 ) {
+        for ( size_t lo = 0; lo < N; lo += 2 * width ) {
+            size_t mid = lo + width < N ? lo + width : N;
+            size_t hi  = mid + width < N ? mid + width : N;
+            size_t a = lo, b = mid, out = lo;
+
+            while ( a < mid && b < hi ) {
+                to.at[out++] = keys[from.at[b]] < keys[from.at[a]]
+                               ? from.at[b++] : from.at[a++];
+            }
+            while ( a < mid ) {
+                to.at[out++] = from.at[a++];
+            }
+            while ( b < hi ) {
+                to.at[out++] = from.at[b++];
+            }
+        }
+        from = to;
+    }
+    return from;
+}
+
+template<class K>
+constexpr bool is_ordered( K const *keys, size_t n )
+{
+    for ( size_t i = 1; i < n; ++i ) {
+        if ( keys[i] < keys[i - 1] ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<$class Key, size_t Width, class... Ts>
+struct sorted_order
+{
+    static constexpr order<sizeof...( Ts )> value =
+        stable_order<sizeof...( Ts )>( keys_of<Key, Ts...>::values, Width );
+};
+
+// `I`-th type of a pack without recursion, found among the bases
+template<size_t I, class T> struct indexed { typedef T type; };
+
+template<class Is, class... Ts> struct indexer;
+
+template<size_t... Is, class... Ts>
+struct indexer<std::index_sequence<Is...>, Ts...> : indexed<Is, Ts>... {};
+
+template<size_t I, class T>
+$deduce pick( indexed<I, T> const & ) -> indexed<I, T>;
+
+template<class Order, $class Head, class... Ts, size_t... Is>
+$deduce permute( Head<Ts...>, std::index_sequence<Is...> )
+-> Head<typename decltype( pick<Order::value.at[Is]>(
+        std::declval<indexer<std::index_sequence_for<Ts...>, Ts...>>() ) )::type...>;
+
+template<$class Key, size_t Width, $class Head, class... Ts>
+$deduce sort( Head<Ts...> l )
+-> decltype( permute<sorted_order<Key, Width, Ts...>>(
+        l, std::index_sequence_for<Ts...>{} ) );
+
+template<$class Key> struct ordered_by
+{
+    template<class... Ts> struct lambda
+    {
+        enum { value = is_ordered( keys_of<Key, Ts...>::values, sizeof...( Ts ) ) };
+    };
+};
+} // impl
+
+/*!
+\class   `sort_t<$class Key, class TList>`
+\brief   `TList` ordered by `Key<T>::value`, equal keys keep their order.
+
+\tparam  Key    sort key: `by_size`, `by_alignment`, `by_value` or a user
+                meta-function with a `constexpr` field `value`.
+\tparam  TList  list of types.
+
+\details Keys are sorted as a `constexpr` array of positions, the types are
+         picked by position from a pack expansion. Instantiations grow as
+         `O( N )` and their depth does not grow with `N`.
+         Usage: `sort_t<by_alignment, foo<char, double, int>>` is
+         `foo<char, int, double>`.
+*/
+template<$class Key, class TList>
+using sort_t = decltype( impl::sort<Key, 1>( std::declval<TList>() ) );
+
+template<$class Key, class TList>
+struct sort { $def sort_t<Key, TList> type; };
+
+/// \brief   `true` if `TList` is ordered by `Key`.
+template<$class Key, class TList>
+constexpr bool is_sorted_v =
+    mind::apply<impl::ordered_by<Key>::$lambda, TList>::value;
+
+template<$class Key, class TList>
+struct is_sorted { enum { value = is_sorted_v<Key, TList> }; };
+
+/// \brief   lists `TList0` and `TList1` sorted by `Key` merged into one,
+///          on equal keys elements of `TList0` go first.
+template<$class Key, class TList0, class TList1>
+using merge_t = decltype(
+    impl::sort<Key, length_v<TList0>>( std::declval<join_t<TList0, TList1>>() ) );
+
+template<$class Key, class TList0, class TList1>
+struct merge { $def merge_t<Key, TList0, TList1> type; };
+
 ////////////////////////////////////////////////////////////////////////////////
 } // mind
@@ -16,6 +16,7 @@
 /// \author Grisha Kirilin
 /// \date   6/5/2018
 
+#pragma once
 
 ////////////////////////////////////////////////////////////////////////////////
 // Includes:
@@ -28,6 +28,7 @@
 #include <type_traits>
 #include <vector>
 #include <algorithm>
+#include <sstream>
 #include <string>
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -36,6 +37,24 @@
 template<class... T> struct foo {};
 template<class... T> struct bar {};
 
+template<int P> struct prio { static constexpr int value = P; };
+
+// 512 keys in a shuffled order
+template<size_t... Is>
+auto shuffled( std::index_sequence<Is...> )
+-> foo<std::integral_constant<size_t, Is * 7919 % sizeof...( Is )>...>;
+
+template<size_t... Is>
+auto ascending( std::index_sequence<Is...> )
+-> foo<std::integral_constant<size_t, Is>...>;
+
+typedef decltype( shuffled( std::make_index_sequence<512>{} ) ) many;
+
+// 512 lists of one element each
+template<size_t... Is>
+auto singles( std::index_sequence<Is...> )
+-> mind::join_t<foo<std::integral_constant<size_t, Is>>...>;
+
 int main()
 {
     using namespace mind;
@@ -47,14 +66,68 @@ int main()
         std::cout << "local value " << value << "\n";
     }
 
-    unit_test( std::cout )
+    // the harness against a hand-written baseline, one of two regressed
+    std::stringstream baseline;
+    baseline
+        << "{ \"benchmarks\": [\n"
+        << "  { \"name\": \"within\", \"median_ns\": 1e9 },\n"
+        << "  { \"name\": \"regressed\", \"median_ns\": 1e-3 } ] }\n";
+
+    bench_options quick;
+    quick.warmup     = 0;
+    quick.runs       = 5;
+    quick.min_run_ns = 1e4;
+
+    std::ostringstream quiet;
+    unit_test bench( quiet );
+    bench.compare_with( baseline )
+         .benchmark( "within", [] { do_not_optimize( 1 ); }, quick )
+         .benchmark( "regressed", [] { do_not_optimize( 2 ); }, quick );
+    size_t regressions = bench.flush_stat();
+
+    std::vector<double> hundred( 100 );
+    for ( size_t i = 0; i < hundred.size(); ++i ) {
+        hundred[i] = double( i + 1 );
+    }
+
+    size_t failed = unit_test( std::cout )
+
+    .section(
+        "Test benchmark harness of `unit_test`",
+        unit_test::percentile( hundred, 99 ) == 99,
+        unit_test::percentile( { 1, 2, 3 }, 99 ) == 3,
+        unit_test::percentile( { 7 }, 50 ) == 7,
+        quiet.str().find( "2 benchmarks" ) != std::string::npos,
+        bench.results().size() == 2 && bench.results()[1].runs == 5,
+        bench.results()[0].min_ns <= bench.results()[0].p99_ns,
+        regressions == 1,
+        quiet.precision() == 6 && !( quiet.flags() & std::ios::floatfield ) )
 
     .section(
         "Test meta-meta function `apply`",
         is_same_v<bar<float>, mind::apply<bar, foo<float>>> )
 
     .section( "Test meta function `join_t`",
-              is_same_v<foo<int, float>, join_t<foo<int>, foo<float>>> )
+              is_same_v<foo<int, float>, join_t<foo<int>, foo<float>>>,
+              is_same_v<list<>, join_t<>>,
+              is_same_v<foo<int>, join_t<foo<int>>>,
+              is_same_v<foo<int, float, int, char>,
+                        join_t<foo<int>, foo<>, foo<float, int>, foo<char>>>,
+              is_same_v<decltype( ascending( std::make_index_sequence<512>{} ) ),
+                        decltype( singles( std::make_index_sequence<512>{} ) )> )
+
+    .section( "Test meta function `transform_t`",
+              is_same_v<foo<>, transform_t<std::add_pointer, foo<>>>,
+              is_same_v<bar<int *, float *>,
+                        transform_t<std::add_pointer, bar<int, float>>> )
+
+    .section( "Test meta function `flatten_t`",
+              is_same_v<foo<>, flatten_t<foo<>>>,
+              is_same_v<foo<int, float>, flatten_t<foo<int, float>>>,
+              is_same_v<maybe<int, float, int>,
+                        flatten_t<maybe<list<int, float>, list<int>>>>,
+              is_same_v<foo<int, float, char, bar<int>>,
+                        flatten_t<foo<foo<int>, list<float, maybe<char>>, bar<int>>>> )
 
     .section( "Test meta predicate `is_member_v`",
               !is_member_v<float, foo<>>,
@@ -104,6 +177,35 @@ int main()
               is_same_set_v<foo<>, head_t<foo<float>>>,
               is_same_set_v<bar<>, head_t<bar<int, float>>> )
 
+    .section( "Test meta function `index_of_v`",
+              index_of_v<int, foo<>> == 0,
+              index_of_v<int, foo<int, float>> == 0,
+              index_of_v<float, bar<int, float, float>> == 1,
+              index_of_v<short, foo<int, float>> == 2 )
+
+    .section( "Test meta function `sort_t`",
+              is_same_v<foo<>, sort_t<by_size, foo<>>>,
+              is_same_v<foo<char, int, double>,
+                        sort_t<by_alignment, foo<char, double, int>>>,
+              is_same_v<bar<char, int, float, double>,
+                        sort_t<by_size, bar<double, char, int, float>>>,
+              is_same_v<foo<prio<-1>, prio<2>, prio<2>, prio<7>>,
+                        sort_t<by_value, foo<prio<2>, prio<7>, prio<-1>, prio<2>>>>,
+              is_same_v<decltype( ascending( std::make_index_sequence<512>{} ) ),
+                        sort_t<by_value, many>> )
+
+    .section( "Test meta predicate `is_sorted_v`",
+              is_sorted_v<by_size, foo<>>,
+              is_sorted_v<by_size, foo<char, short, int, int>>,
+              !is_sorted_v<by_size, foo<int, char>>,
+              !is_sorted_v<by_value, many>,
+              is_sorted_v<by_value, sort_t<by_value, many>> )
+
+    .section( "Test meta function `merge_t`",
+              is_same_v<foo<char>, merge_t<by_size, foo<>, foo<char>>>,
+              is_same_v<foo<char, float, int, double>,
+                        merge_t<by_size, foo<char, float>, foo<int, double>>> )
+
     .section( "Test meta function `unique_t`",
               is_same_set_v<foo<>, unique_t<foo<>>>,
               is_same_set_v<foo<float>, unique_t<foo<float>>>,
@@ -112,7 +214,7 @@ int main()
 
     .flush_stat();
 
-    return 0;
+    return failed ? 1 : 0;
 }
 
 WUBBA_LUBBA_DUB_DUB
@@ -16,6 +16,8 @@
 /// \author Grisha Kirilin
 /// \date   7/5/2018
 
+#pragma once
+
 ////////////////////////////////////////////////////////////////////////////////
 // Includes:
 
@@ -24,6 +26,142 @@
 #include <vector>
 #include <algorithm>
 #include <string>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Keep a value alive for the optimizer, the way google benchmark does.
+
+template<class T>
+inline void do_not_optimize( T const &value )
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+    asm volatile ( "" : : "r,m" ( value ) : "memory" );
+#else
+    static char const volatile *sink;
+    sink = reinterpret_cast<char const volatile *>( &value );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Hardware counters: cycles, instructions and cache misses of this thread.
+
+class perf_counters
+{
+public:
+
+    enum { cycles, instructions, cache_misses, count };
+
+    perf_counters()
+    {
+#ifdef __linux__
+        std::array<uint64_t, count> configs = {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_MISSES
+        };
+
+        for ( int i = 0; i < count; ++i ) {
+            perf_event_attr attr{};
+            attr.size           = sizeof( attr );
+            attr.type           = PERF_TYPE_HARDWARE;
+            attr.config         = configs[i];
+            attr.disabled       = i == 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            attr.read_format    = PERF_FORMAT_GROUP;
+
+            fds_[i] = int( syscall( __NR_perf_event_open, &attr, 0, -1,
+                                    i == 0 ? -1 : fds_[0], 0 ) );
+            if ( fds_[i] < 0 ) {
+                close_all();
+                return;
+            }
+        }
+#endif
+    }
+
+    ~perf_counters() { close_all(); }
+
+    perf_counters( perf_counters const & )            = delete;
+    perf_counters& operator=( perf_counters const & ) = delete;
+
+    bool valid() const { return fds_[0] >= 0; }
+
+    void start()
+    {
+#ifdef __linux__
+        if ( valid() ) {
+            ioctl( fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP );
+            ioctl( fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+        }
+#endif
+    }
+
+    std::array<uint64_t, count> stop()
+    {
+        std::array<uint64_t, count> values{};
+#ifdef __linux__
+        uint64_t group[1 + count] = {};
+        if ( valid() ) {
+            ioctl( fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP );
+            if ( read( fds_[0], group, sizeof( group ) ) == sizeof( group ) ) {
+                std::copy( group + 1, group + 1 + count, values.begin() );
+            }
+        }
+#endif
+        return values;
+    }
+
+private:
+
+    void close_all()
+    {
+#ifdef __linux__
+        for ( int &fd : fds_ ) {
+            if ( fd >= 0 ) {
+                close( fd );
+            }
+            fd = -1;
+        }
+#endif
+    }
+
+    std::array<int, count> fds_ = { -1, -1, -1 };
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Options and results of a benchmark section.
+
+struct bench_options
+{
+    size_t warmup     = 3;      // runs thrown away
+    size_t runs       = 31;     // runs measured
+    double min_run_ns = 1e6;    // iterations grow until a run is this long
+    bool   counters   = false;  // read hardware counters, if allowed
+};
+
+struct bench_result
+{
+    std::string name;
+    size_t iterations = 0;      // per run
+    size_t runs       = 0;
+    double min_ns     = 0;      // per iteration
+    double median_ns  = 0;
+    double p99_ns     = 0;
+    double counters[perf_counters::count] = { -1, -1, -1 }; // per iteration
+};
 
 ////////////////////////////////////////////////////////////////////////////////
 // TODO: choose some standard framework.
@@ -47,15 +185,149 @@ public:
         return *this;
     }
 
-    void flush_stat()
+    /// \brief   time `f`, a run calls it as many times as it takes to last
+    ///          `min_run_ns`. With a baseline loaded a median slower than
+    ///          the baseline by more than the tolerance fails the section.
+    template<class F>
+    unit_test& benchmark( std::string name, F f, bench_options options = {} )
+    {
+        using clock = std::chrono::steady_clock;
+
+        auto time_run = [&f]( size_t iterations ) {
+            auto start = clock::now();
+            for ( size_t i = 0; i < iterations; ++i ) {
+                f();
+            }
+            return std::chrono::duration<double, std::nano>( clock::now() - start )
+                   .count();
+        };
+
+        size_t iterations = 1;
+        for ( double ns = time_run( 1 ); ns < options.min_run_ns; ns = time_run( iterations ) ) {
+            double grow = ns > 0 ? options.min_run_ns / ns * 1.2 : 10;
+            iterations  = size_t( iterations * std::min( std::max( grow, 2.0 ), 10.0 ) );
+        }
+
+        for ( size_t i = 0; i < options.warmup; ++i ) {
+            time_run( iterations );
+        }
+
+        perf_counters perf;
+        bool counting = options.counters && perf.valid();
+
+        std::vector<double> per_iteration;
+        if ( counting ) {
+            perf.start();
+        }
+        for ( size_t i = 0; i < std::max<size_t>( options.runs, 1 ); ++i ) {
+            per_iteration.push_back( time_run( iterations ) / iterations );
+        }
+
+        bench_result r;
+        r.name       = name;
+        r.iterations = iterations;
+        r.runs       = per_iteration.size();
+
+        if ( counting ) {
+            auto values = perf.stop();
+            for ( int i = 0; i < perf_counters::count; ++i ) {
+                r.counters[i] = double( values[i] ) / ( iterations * r.runs );
+            }
+        }
+
+        std::sort( per_iteration.begin(), per_iteration.end() );
+        r.min_ns    = per_iteration.front();
+        r.median_ns = per_iteration[per_iteration.size() / 2];
+        r.p99_ns    = percentile( per_iteration, 99 );
+
+        log_bench( r, options.counters && !counting );
+        results_.push_back( r );
+        return *this;
+    }
+
+    /// \brief   load medians written by `save_json` and fail later
+    ///          benchmarks which are slower by more than `tolerance`.
+    unit_test& compare_with( std::string path, double tolerance = 0.10 )
+    {
+        std::ifstream in( path );
+        return compare_with( in, tolerance, path );
+    }
+
+    /// \brief   as above, the medians are read from `in`.
+    unit_test& compare_with( std::istream &in, double tolerance = 0.10,
+                             std::string name = "stream" )
+    {
+        std::stringstream text;
+        text << in.rdbuf();
+
+        baseline_.clear();
+        tolerance_ = tolerance;
+
+        std::string s = text.str();
+        for ( size_t at = s.find( "\"name\"" ); at != std::string::npos;
+              at = s.find( "\"name\"", at + 1 ) ) {
+            size_t open   = s.find( '"', s.find( ':', at ) );
+            size_t close  = s.find( '"', open + 1 );
+            size_t median = s.find( "\"median_ns\"", close );
+            if ( close == std::string::npos || median == std::string::npos ) {
+                break;
+            }
+            baseline_[s.substr( open + 1, close - open - 1 )] =
+                std::stod( s.substr( s.find( ':', median ) + 1 ) );
+        }
+
+        log_stream_ << "baseline " << name << ": " << baseline_.size()
+                    << " benchmarks\n\n";
+        return *this;
+    }
+
+    /// \brief   write the results of all the benchmarks as JSON.
+    unit_test& save_json( std::string path )
+    {
+        std::ofstream out( path );
+        out << "{\n  \"benchmarks\": [";
+
+        char const *separator = "\n";
+        for ( auto const &r : results_ ) {
+            out << separator << "    { \"name\": \"" << r.name << "\""
+                << ", \"iterations\": " << r.iterations
+                << ", \"runs\": " << r.runs
+                << ", \"min_ns\": " << r.min_ns
+                << ", \"median_ns\": " << r.median_ns
+                << ", \"p99_ns\": " << r.p99_ns;
+            if ( r.counters[perf_counters::cycles] >= 0 ) {
+                out << ", \"cycles\": " << r.counters[perf_counters::cycles]
+                    << ", \"instructions\": " << r.counters[perf_counters::instructions]
+                    << ", \"cache_misses\": " << r.counters[perf_counters::cache_misses];
+            }
+            out << " }";
+            separator = ",\n";
+        }
+        out << "\n  ]\n}\n";
+        return *this;
+    }
+
+    /// \brief   `p`-th percentile of sorted values by the nearest rank.
+    static double percentile( std::vector<double> const &sorted, size_t p )
+    {
+        size_t rank = ( sorted.size() * p + 99 ) / 100;
+        return sorted[rank > 0 ? rank - 1 : 0];
+    }
+
+    std::vector<bench_result> const& results() const { return results_; }
+
+    /// \brief   log the totals and return the number of failures.
+    size_t flush_stat()
     {
         auto passed_cnt = std::count( stat_.begin(), stat_.end(), true );
+        size_t failed   = stat_.size() - passed_cnt;
 
         log_stream_ << "results: "
                     << passed_cnt << " tests passed, "
-                    << ( stat_.size() - passed_cnt ) << " tests failed\n"
+                    << failed << " tests failed\n"
                     << std::endl;
         stat_.clear();
+        return failed;
     }
 
 protected:
@@ -66,6 +338,43 @@ protected:
         stat_.push_back( passed );
     }
 
+    // numbers go through a local stream, the flags of `log_stream_` stay
+    void log_bench( bench_result const &r, bool no_counters )
+    {
+        std::ostringstream text;
+        text << std::fixed << std::setprecision( 2 )
+             << "Benchmark `" << r.name << "`: "
+             << r.runs << " runs of " << r.iterations << " iterations\n"
+             << "min " << r.min_ns << " ns, median " << r.median_ns
+             << " ns, p99 " << r.p99_ns << " ns\n";
+
+        if ( r.counters[perf_counters::cycles] >= 0 ) {
+            text << "cycles " << r.counters[perf_counters::cycles]
+                 << ", instructions " << r.counters[perf_counters::instructions]
+                 << ", cache misses " << r.counters[perf_counters::cache_misses]
+                 << "\n";
+        }
+        else if ( no_counters ) {
+            text << "hardware counters are not available\n";
+        }
+
+        auto base = baseline_.find( r.name );
+        if ( base != baseline_.end() ) {
+            text << "baseline median " << base->second << " ns, limit "
+                 << base->second * ( 1 + tolerance_ ) << " ns\n";
+        }
+        log_stream_ << text.str();
+
+        if ( base != baseline_.end() ) {
+            log_result( r.median_ns <= base->second * ( 1 + tolerance_ ) );
+        }
+        log_stream_ << "\n";
+    }
+
     std::ostream &log_stream_;
     std::vector<bool> stat_; // sic!
+
+    std::vector<bench_result> results_;
+    std::map<std::string, double> baseline_;
+    double tolerance_ = 0.10;
 };